@@ -1,7 +1,7 @@
 //
 //    FILE: AD5144A.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: I2C digital potentiometer AD5144A
 //    DATE: 2021-04-30
 //     URL: https://github.com/RobTillaart/AD5144A
@@ -10,6 +10,8 @@
 //  0.1.0   2021-04-30  initial version
 //  0.1.1   2021-05-12  add topScale() and bottomScale()
 //  0.1.2   2021-05-12  add increment() and decrement() functions
+//  0.1.3   2021-09-05  add writeValues() batch, ramp and AD51XXGroup
+//                      needs the PotGroup library
 
 
 #include "AD5144A.h"
@@ -28,6 +30,10 @@ AD51XX::AD51XX(const uint8_t address, TwoWire *wire)
 {
   _address = address;
   _wire = wire;
+  for (uint8_t pm = 0; pm < 4; pm++)
+  {
+    _lastValue[pm] = 0;
+  }
 }
 
 
@@ -77,6 +83,7 @@ uint8_t AD51XX::writeAll(const uint8_t value)
   for (uint8_t pm = 0; pm < _potCount; pm++)
   {
     _lastValue[pm] = value;
+    _ramp.setTarget(pm, value);
   }
   uint8_t cmd = 0x18;
   return send(cmd, value);
@@ -88,11 +95,83 @@ uint8_t AD51XX::write(const uint8_t rdac, const uint8_t value)
   // COMMAND 1 - page 29
   if (rdac >= _potCount) return AD51XXA_INVALID_POT;
   _lastValue[rdac] = value;
+  _ramp.setTarget(rdac, value);
   uint8_t cmd = 0x10 | rdac;
   return send(cmd, _lastValue[rdac]);
 }
 
 
+uint8_t AD51XX::writeValues(const uint8_t * values)
+{
+  // value needed by most channels is candidate for COMMAND 1 all channels
+  uint8_t changed = 0;
+  uint8_t best = 0;
+  uint8_t bestCount = 0;
+  for (uint8_t i = 0; i < _potCount; i++)
+  {
+    if (values[i] != _lastValue[i]) changed++;
+    uint8_t cnt = 0;
+    for (uint8_t j = 0; j < _potCount; j++)
+    {
+      if (values[j] == values[i]) cnt++;
+    }
+    if (cnt > bestCount)
+    {
+      best = values[i];
+      bestCount = cnt;
+    }
+  }
+
+  uint8_t count = 0;
+  // writeAll + fix the others is cheaper than per channel
+  if (1 + _potCount - bestCount < changed)
+  {
+    send(0x18, best);
+    count++;
+    for (uint8_t rdac = 0; rdac < _potCount; rdac++)
+    {
+      _lastValue[rdac] = best;
+    }
+  }
+  for (uint8_t rdac = 0; rdac < _potCount; rdac++)
+  {
+    if (values[rdac] == _lastValue[rdac]) continue;
+    _lastValue[rdac] = values[rdac];
+    send(0x10 | rdac, values[rdac]);
+    count++;
+  }
+  return count;
+}
+
+
+void AD51XX::setTarget(const uint8_t rdac, const uint8_t value)
+{
+  if (rdac >= _potCount) return;
+  _ramp.setTarget(rdac, value);
+}
+
+
+uint8_t AD51XX::getTarget(const uint8_t rdac)
+{
+  if (rdac >= _potCount) return 0;
+  return _ramp.getTarget(rdac);
+}
+
+
+void AD51XX::startRamp()
+{
+  _ramp.start(_lastValue, _potCount);
+}
+
+
+uint8_t AD51XX::rampStep(const uint16_t step, const uint16_t steps)
+{
+  uint8_t values[4];
+  _ramp.values(values, _potCount, step, steps);
+  return writeValues(values);
+}
+
+
 uint8_t AD51XX::storeEEPROM(const uint8_t rdac)
 {
   // COMMAND 9 - page 29
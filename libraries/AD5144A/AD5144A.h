@@ -2,7 +2,7 @@
 //
 //    FILE: AD5144A.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: I2C digital PotentioMeter AD5144A
 //    DATE: 2021-04-30
 //     URL: https://github.com/RobTillaart/AD5144A
@@ -10,15 +10,20 @@
 
 #include "Arduino.h"
 #include "Wire.h"
+#include "PotGroup.h"
 
 
-#define AD51XXA_VERSION        (F("0.1.2_experimental"))
+#define AD51XXA_VERSION        (F("0.1.3_experimental"))
 
 
 #define AD51XXA_OK             0
 #define AD51XXA_ERROR          100
 #define AD51XXA_INVALID_POT    101
 
+#ifndef AD51XX_GROUP_SIZE
+#define AD51XX_GROUP_SIZE      8
+#endif
+
 
 class AD51XX
 {
@@ -40,6 +45,19 @@ public:
   uint8_t read(const uint8_t rdac) { return _lastValue[rdac]; };
 
 
+  // BATCH
+  // values[pmCount()], only changed channels are written.
+  // uses writeAll() when that needs fewer transactions.
+  // returns the number of I2C transactions.
+  uint8_t writeValues(const uint8_t * values);
+
+  // RAMP - see AD51XXGroup, uses PotRamp
+  void    setTarget(const uint8_t rdac, const uint8_t value);
+  uint8_t getTarget(const uint8_t rdac);
+  void    startRamp();
+  uint8_t rampStep(const uint16_t step, const uint16_t steps);
+
+
   // EEPROM functions
   // defines power up value; copies between RDAC and EEPROM
   uint8_t storeEEPROM(const uint8_t rdac);
@@ -129,6 +147,7 @@ private:
 
   uint8_t _address;
   uint8_t _lastValue[4];
+  PotRamp<4> _ramp;
 
   TwoWire*  _wire;
 };
@@ -186,4 +205,11 @@ public:
 };
 
 
+//////////////////////////////////////////////////////////////
+//
+// GROUP - see PotGroup library
+//
+typedef PotGroup<AD51XX, AD51XX_GROUP_SIZE> AD51XXGroup;
+
+
 // -- END OF FILE --
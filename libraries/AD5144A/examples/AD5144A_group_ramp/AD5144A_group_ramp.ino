@@ -0,0 +1,85 @@
+//
+//    FILE: AD5144A_group_ramp.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: demo ramping 8 channels of two devices smoothly
+//    DATE: 2021-09-05
+//     URL: https://github.com/RobTillaart/AD5144A
+
+
+#include "AD5144A.h"
+
+// select the right type
+// adjust address
+AD5144A AD1(0x2C);
+AD5144A AD2(0x2D);
+
+AD51XXGroup group;
+
+uint32_t start, stop;
+bool up = true;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+
+  Wire.begin();
+  Wire.setClock(400000);
+  if ((AD1.begin() == false) || (AD2.begin() == false))
+  {
+    Serial.println("check connection");
+    while (1);
+  }
+  group.add(&AD1);
+  group.add(&AD2);
+
+  // performance: 8 channels to 0 as fast as possible
+  // channel 3 of the second device to another value.
+  group.setTargetAll(0);
+  group.setTarget(1, 3, 64);
+  group.startRamp(128, 0);
+  start = micros();
+  while (group.isRamping()) group.update();
+  stop = micros();
+  Serial.print("128 steps x 8 channels:\t");
+  Serial.println(stop - start);
+  Serial.print("I2C writes:\t");
+  Serial.println(group.getWriteCount());
+  Serial.print("steps per second:\t");
+  Serial.println(128 * 1e6 / (stop - start));
+  delay(100);
+
+  // compare with 8 individual writes per step
+  start = micros();
+  for (int step = 0; step < 128; step++)
+  {
+    for (int rdac = 0; rdac < 4; rdac++)
+    {
+      AD1.write(rdac, step);
+      AD2.write(rdac, step);
+    }
+  }
+  stop = micros();
+  Serial.print("128 steps x 8 write():\t");
+  Serial.println(stop - start);
+  delay(100);
+}
+
+
+void loop()
+{
+  group.update();
+
+  if (!group.isRamping())
+  {
+    // 2 second fade, 10 ms per step
+    group.setTargetAll(up ? 255 : 0);
+    up = !up;
+    group.startRamp(200, 10000);
+  }
+}
+
+
+// -- END OF FILE --
@@ -44,6 +44,96 @@ unittest(test_constructors)
 }
 
 
+unittest(test_writeValues)
+{
+  Wire.begin();
+  Wire.resetMocks();
+
+  AD5144A AD(0x2C);
+  AD.writeAll(0);
+  assertEqual(1, Wire.getMosi(0x2C)->size() / 2);
+
+  // all the same => writeAll()
+  uint8_t v1[4] = { 20, 20, 20, 20 };
+  assertEqual(1, AD.writeValues(v1));
+  // 3 the same => writeAll() + 1
+  uint8_t v2[4] = { 30, 30, 40, 30 };
+  assertEqual(2, AD.writeValues(v2));
+  for (int i = 0; i < 4; i++)
+  {
+    assertEqual(v2[i], AD.read(i));
+  }
+  // one changed => single write
+  uint8_t v3[4] = { 30, 31, 40, 30 };
+  assertEqual(1, AD.writeValues(v3));
+  // no-op writes are skipped
+  assertEqual(0, AD.writeValues(v3));
+  assertEqual(5, Wire.getMosi(0x2C)->size() / 2);
+}
+
+
+unittest(test_group_ramp)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.begin();
+  Wire.resetMocks();
+
+  AD5144A AD1(0x2C);
+  AD5144A AD2(0x2D);
+  AD1.writeAll(0);
+  AD2.writeAll(0);
+  Wire.resetMocks();
+
+  AD51XXGroup group;
+  assertTrue(group.add(&AD1));
+  assertTrue(group.add(&AD2));
+  assertEqual(2, group.count());
+
+  group.setTargetAll(200);
+  group.setTarget(1, 3, 100);
+  assertEqual(200, AD1.getTarget(0));
+  assertEqual(100, AD2.getTarget(3));
+
+  group.startRamp(100, 1000);
+  assertTrue(group.isRamping());
+  assertEqual(0, group.update());    // not due yet
+
+  state->micros += 1000;
+  assertEqual(1 + 2, group.update());
+  assertEqual(2, AD1.read(0));
+  assertEqual(1, AD2.read(3));
+
+  state->micros += 200000;
+  group.update();
+  assertFalse(group.isRamping());
+  assertEqual(200, AD1.read(3));
+  assertEqual(200, AD2.read(2));
+  assertEqual(100, AD2.read(3));
+  // both steps: AD1 writeAll, AD2 writeAll + channel 3
+  assertEqual(3 + 3, group.getWriteCount());
+
+  // targets reached => no writes
+  assertEqual(0, group.write());
+
+  // all steps of a 100 step ramp of 8 channels
+  group.setTargetAll(0);
+  group.setTarget(1, 3, 50);
+  group.resetWriteCount();
+  group.startRamp(100, 0);
+  while (group.isRamping()) group.update();
+  uint32_t writes = group.getWriteCount();
+  assertLessOrEqual(writes, 300);
+  // 2 bytes per transaction, 6 transactions before
+  assertEqual(writes * 2 + 6 * 2, Wire.getMosi(0x2C)->size() + Wire.getMosi(0x2D)->size());
+
+  // I2C bit times: START + address + cmd + value + STOP
+  float us = (1 + 9 + 18 + 1) * 2.5;
+  fprintf(stderr, "400 KHz ramp steps / sec 8 channels: \t%d (per channel writes: %d)\n",
+    (int)(1e6 * 100 / (writes * us)), (int)(1e6 / (8 * us)));
+}
+
+
 unittest_main()
 
 // --------
@@ -2,7 +2,7 @@
 //    FILE: AD520X.cpp
 //  AUTHOR: Rob Tillaart
 //    DATE: 2020-07-24
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: Arduino library for AD5204 and AD5206 digital potentiometers (+ older AD8400, AD8402, AD8403)
 //     URL: https://github.com/RobTillaart/AD520X
 //
@@ -14,12 +14,15 @@
 //  0.1.2   2021-08-19  VSPI / HSPI support for ESP32 only
 //                      add setGPIOpins for ESP32 only
 //                      add SetSPIspeed (generic)
+//  0.1.3   2021-09-05  add setValues() batch, ramp and AD520XGroup
+//                      needs the PotGroup library
+//                      setAll() uses one SPI transaction
 
 
 #include "AD520X.h"
 
 
-AD520X::AD520X(uint8_t select, uint8_t reset, uint8_t shutdown, uint8_t dataOut, uint8_t clock)
+AD520X::AD520X(uint8_t select, uint8_t reset, uint8_t shutdown, uint8_t dataOut, uint8_t clock) : _ramp(128)
 {
   _pmCount  = 6;
   _select   = select;
@@ -28,6 +31,10 @@ AD520X::AD520X(uint8_t select, uint8_t reset, uint8_t shutdown, uint8_t dataOut,
   _reset    = reset;
   _shutdown = shutdown;
   _hwSPI    = (dataOut == 255) && (clock == 255);
+  for (uint8_t pm = 0; pm < 6; pm++)
+  {
+    _value[pm] = 128;
+  }
 }
 
 
@@ -96,6 +103,7 @@ void AD520X::setValue(uint8_t pm, uint8_t value)
 {
   if (pm >= _pmCount) return;
   _value[pm] = value;
+  _ramp.setTarget(pm, value);
   updateDevice(pm);
 }
 
@@ -104,8 +112,54 @@ void  AD520X::setAll(uint8_t value)
 {
   for (uint8_t pm = 0; pm < _pmCount; pm++)
   {
-    setValue(pm, value);
+    _value[pm] = value;
+    _ramp.setTarget(pm, value);
+  }
+  updateDevices((1 << _pmCount) - 1);
+}
+
+
+uint8_t AD520X::setValues(const uint8_t * values)
+{
+  uint8_t mask  = 0;
+  uint8_t count = 0;
+  for (uint8_t pm = 0; pm < _pmCount; pm++)
+  {
+    if (_value[pm] == values[pm]) continue;
+    _value[pm] = values[pm];
+    mask |= (1 << pm);
+    count++;
   }
+  if (mask) updateDevices(mask);
+  return count;
+}
+
+
+void AD520X::setTarget(uint8_t pm, uint8_t value)
+{
+  if (pm >= _pmCount) return;
+  _ramp.setTarget(pm, value);
+}
+
+
+uint8_t AD520X::getTarget(uint8_t pm)
+{
+  if (pm >= _pmCount) return 0;
+  return _ramp.getTarget(pm);
+}
+
+
+void AD520X::startRamp()
+{
+  _ramp.start(_value, _pmCount);
+}
+
+
+uint8_t AD520X::rampStep(uint16_t step, uint16_t steps)
+{
+  uint8_t values[6];
+  _ramp.values(values, _pmCount, step, steps);
+  return setValues(values);
 }
 
 
@@ -154,6 +208,30 @@ void AD520X::updateDevice(uint8_t pm)
 }
 
 
+// multiple channels in one SPI transaction, only the select line toggles.
+void AD520X::updateDevices(uint8_t mask)
+{
+  if (_hwSPI) mySPI->beginTransaction(_spi_settings);
+  for (uint8_t pm = 0; pm < _pmCount; pm++)
+  {
+    if ((mask & (1 << pm)) == 0) continue;
+    digitalWrite(_select, LOW);
+    if (_hwSPI)
+    {
+      mySPI->transfer(pm);
+      mySPI->transfer(_value[pm]);
+    }
+    else // Software SPI
+    {
+      swSPI_transfer(pm);
+      swSPI_transfer(_value[pm]);
+    }
+    digitalWrite(_select, HIGH);
+  }
+  if (_hwSPI) mySPI->endTransaction();
+}
+
+
 // simple one mode version
 void AD520X::swSPI_transfer(uint8_t val)
 {
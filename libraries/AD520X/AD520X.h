@@ -3,7 +3,7 @@
 //    FILE: AD520X.h
 //  AUTHOR: Rob Tillaart
 //    DATE: 2020-07-24
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: Arduino library for AD5204 and AD5206 digital potentiometers (+ older AD8400, AD8402, AD8403)
 //     URL: https://github.com/RobTillaart/AD520X
 //
@@ -14,9 +14,14 @@
 
 #include "Arduino.h"
 #include "SPI.h"
+#include "PotGroup.h"
 
 
-#define AD520X_LIB_VERSION          (F("0.1.2"))
+#define AD520X_LIB_VERSION          (F("0.1.3"))
+
+#ifndef AD520X_GROUP_SIZE
+#define AD520X_GROUP_SIZE           8
+#endif
 
 
 class AD520X
@@ -29,6 +34,17 @@ public:
   void     setAll(uint8_t value);
   uint8_t  getValue(uint8_t pm);
 
+  //       BATCH
+  //       values[pmCount()], only changed channels are written,
+  //       all in one SPI transaction. Returns number of channels written.
+  uint8_t  setValues(const uint8_t * values);
+
+  //       RAMP - see AD520XGroup, uses PotRamp
+  void     setTarget(uint8_t pm, uint8_t value);
+  uint8_t  getTarget(uint8_t pm);
+  void     startRamp();
+  uint8_t  rampStep(uint16_t step, uint16_t steps);
+
   void     reset(uint8_t value = 128);
   int      pmCount()   { return _pmCount; };
 
@@ -66,9 +82,11 @@ protected:
   uint32_t _SPIspeed = 16000000;
 
   uint8_t  _value[6];
+  PotRamp<6> _ramp;
   uint8_t  _pmCount = 6;
 
   void     updateDevice(uint8_t pm);
+  void     updateDevices(uint8_t mask);
   void     swSPI_transfer(uint8_t value);
 
   SPIClass    * mySPI;
@@ -118,4 +136,11 @@ public:
   AD8403(uint8_t select, uint8_t reset, uint8_t shutdown, uint8_t dataOut = 255, uint8_t clock = 255); 
 };
 
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// GROUP - see PotGroup library
+//
+typedef PotGroup<AD520X, AD520X_GROUP_SIZE> AD520XGroup;
+
 // -- END OF FILE -- 
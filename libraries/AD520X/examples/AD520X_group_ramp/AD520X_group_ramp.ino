@@ -0,0 +1,78 @@
+//
+//    FILE: AD520X_group_ramp.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: demo ramping potentiometers of two devices smoothly
+//    DATE: 2021-09-05
+//     URL: https://github.com/RobTillaart/AD520X
+
+
+#include "AD520X.h"
+
+
+uint32_t start, stop;
+
+// param: select, reset, shutdown, data, clock
+AD5206 left  = AD5206(10, 12, 13);   // HW SPI
+AD5206 right = AD5206(9, 12, 13);    // HW SPI
+
+AD520XGroup group;
+
+bool up = true;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("AD520X_LIB_VERSION:\t");
+  Serial.println(AD520X_LIB_VERSION);
+
+  left.begin(0);
+  right.begin(0);
+  group.add(&left);
+  group.add(&right);
+
+  // performance: all 12 channels 0 -> 255 as fast as possible
+  group.setTargetAll(255);
+  group.startRamp(255, 0);
+  start = micros();
+  while (group.isRamping()) group.update();
+  stop = micros();
+  Serial.print("255 steps x 12 channels:\t");
+  Serial.println(stop - start);
+  Serial.print("writes:\t");
+  Serial.println(group.getWriteCount());
+  Serial.print("steps per second:\t");
+  Serial.println(255 * 1e6 / (stop - start));
+  delay(100);
+
+  group.setTargetAll(0);
+  group.write();
+}
+
+
+void loop()
+{
+  group.update();
+
+  if (!group.isRamping())
+  {
+    // 2 second fade, 10 ms per step
+    if (up)
+    {
+      group.setTargetAll(200);
+      // right channel 3 a bit softer
+      group.setTarget(1, 3, 150);
+    }
+    else
+    {
+      group.setTargetAll(20);
+    }
+    up = !up;
+    group.startRamp(200, 10000);
+  }
+}
+
+
+// -- END OF FILE --
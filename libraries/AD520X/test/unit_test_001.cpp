@@ -129,6 +129,78 @@ unittest(test_pm_count)
 }
 
 
+unittest(test_setValues)
+{
+  AD5206 pot = AD5206(10, 12, 13);  // HW SPI
+  pot.begin(100);
+
+  uint8_t values[6] = { 100, 100, 110, 120, 100, 130 };
+  assertEqual(3, pot.setValues(values));
+  for (int i = 0; i < pot.pmCount(); i++)
+  {
+    assertEqual(values[i], pot.getValue(i));
+  }
+  // no-op writes are skipped
+  assertEqual(0, pot.setValues(values));
+}
+
+
+unittest(test_group_ramp)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  AD5206 pot1 = AD5206(10, 12, 13);  // HW SPI
+  AD5204 pot2 = AD5204(11, 12, 13);  // HW SPI
+  pot1.begin(0);
+  pot2.begin(0);
+
+  AD520XGroup group;
+  assertTrue(group.add(&pot1));
+  assertTrue(group.add(&pot2));
+  assertEqual(2, group.count());
+
+  group.setTargetAll(200);
+  group.setTarget(1, 3, 0);        // stays 0 => never written
+  assertEqual(200, pot1.getTarget(0));
+  assertEqual(0, pot2.getTarget(3));
+
+  group.startRamp(10, 1000);
+  assertTrue(group.isRamping());
+  assertEqual(0, group.update());  // not due yet
+
+  state->micros += 1000;
+  assertEqual(9, group.update());  // 6 + 3 channels
+  assertEqual(20, pot1.getValue(0));
+  assertEqual(1, group.getStep());
+
+  // late call jumps to the due step
+  state->micros += 5000;
+  assertEqual(9, group.update());
+  assertEqual(6, group.getStep());
+  assertEqual(120, pot2.getValue(0));
+
+  state->micros += 10000;
+  group.update();
+  assertFalse(group.isRamping());
+  assertEqual(10, group.getStep());
+  assertEqual(200, pot1.getValue(5));
+  assertEqual(200, pot2.getValue(2));
+  assertEqual(0, pot2.getValue(3));
+  assertEqual(27, group.getWriteCount());
+
+  // targets reached => no writes
+  assertEqual(0, group.write());
+
+  group.setTarget(0, 0, 50);
+  assertEqual(1, group.write());
+  assertEqual(50, pot1.getValue(0));
+
+  // SPI transactions per ramp step: one per device instead of one per channel
+  fprintf(stderr, "SPI transactions per step:\t%d (was %d)\n", group.count(), 9);
+}
+
+
 unittest_main()
 
 // --------
@@ -1,11 +1,16 @@
 //
 //    FILE: AD524X.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.1
+// VERSION: 0.3.2
 // PURPOSE: I2C digital potentiometer AD5241 AD5242
 //    DATE: 2013-10-12
 //     URL: https://github.com/RobTillaart/AD524X
 //
+//  HISTORY
+//  0.3.2   2021-09-05  add writeValues() batch, ramp and AD524XGroup
+//                      needs the PotGroup library
+//                      fix send() + readBackRegister() to use _wire
+//
 
 #include "AD524X.h"
 
@@ -17,7 +22,7 @@
 #define AS524X_O2_HIGH  0x08
 
 
-AD524X::AD524X(const uint8_t address, TwoWire *wire)
+AD524X::AD524X(const uint8_t address, TwoWire *wire) : _ramp(127)
 {
   // address: 0x01011xx = 0x2C - 0x2F
   _address = address;
@@ -82,6 +87,7 @@ uint8_t AD524X::write(const uint8_t rdac, const uint8_t value)
   // apply the output lines
   cmd = cmd | _O1 | _O2;
   _lastValue[rdac] = value;
+  _ramp.setTarget(rdac, value);
   return send(cmd, value);
 }
 
@@ -95,9 +101,55 @@ uint8_t AD524X::write(const uint8_t rdac, const uint8_t value, const uint8_t O1,
   // apply the output lines
   cmd = cmd | _O1 | _O2;
   _lastValue[rdac] = value;
+  _ramp.setTarget(rdac, value);
   return send(cmd, value);
 }
 
+
+uint8_t AD524X::writeValues(const uint8_t * values)
+{
+  uint8_t count = 0;
+  for (uint8_t rdac = 0; rdac < _pmCount; rdac++)
+  {
+    if (_lastValue[rdac] == values[rdac]) continue;
+    uint8_t cmd = (rdac == 0) ? AS524X_RDAC0 : AS524X_RDAC1;
+    cmd = cmd | _O1 | _O2;
+    _lastValue[rdac] = values[rdac];
+    send(cmd, values[rdac]);
+    count++;
+  }
+  return count;
+}
+
+
+void AD524X::setTarget(const uint8_t rdac, const uint8_t value)
+{
+  if (rdac >= _pmCount) return;
+  _ramp.setTarget(rdac, value);
+}
+
+
+uint8_t AD524X::getTarget(const uint8_t rdac)
+{
+  if (rdac >= _pmCount) return 0;
+  return _ramp.getTarget(rdac);
+}
+
+
+void AD524X::startRamp()
+{
+  _ramp.start(_lastValue, _pmCount);
+}
+
+
+uint8_t AD524X::rampStep(const uint16_t step, const uint16_t steps)
+{
+  uint8_t values[2];
+  _ramp.values(values, _pmCount, step, steps);
+  return writeValues(values);
+}
+
+
 uint8_t AD524X::setO1(const uint8_t value)
 {
   _O1 = (value == LOW) ? 0 : AS524X_O1_HIGH;
@@ -129,10 +181,10 @@ uint8_t AD524X::read(const uint8_t rdac)
 
 uint8_t AD524X::readBackRegister()
 {
-  Wire.beginTransmission(_address);
-  Wire.endTransmission();
-  Wire.requestFrom(_address, (uint8_t)1);
-  return Wire.read();
+  _wire->beginTransmission(_address);
+  _wire->endTransmission();
+  _wire->requestFrom(_address, (uint8_t)1);
+  return _wire->read();
 }
 
 uint8_t AD524X::midScaleReset(const uint8_t rdac)
@@ -143,6 +195,7 @@ uint8_t AD524X::midScaleReset(const uint8_t rdac)
   if (rdac == 1) cmd |= AS524X_RDAC1;
   cmd = cmd | _O1 | _O2;
   _lastValue[rdac] = 127;
+  _ramp.setTarget(rdac, 127);
   return send(cmd, _lastValue[rdac]);
 }
 
@@ -160,10 +213,10 @@ uint8_t AD524X::shutDown()
 //
 uint8_t AD524X::send(const uint8_t cmd, const uint8_t value)
 {
-  Wire.beginTransmission(_address);
-  Wire.write(cmd);
-  Wire.write(value);
-  return Wire.endTransmission();
+  _wire->beginTransmission(_address);
+  _wire->write(cmd);
+  _wire->write(value);
+  return _wire->endTransmission();
 }
 
 /////////////////////////////////////////////////////////////////////////////
@@ -2,7 +2,7 @@
 //
 //    FILE: AD524X.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.1
+// VERSION: 0.3.2
 // PURPOSE: I2C digital PotentioMeter AD5241 AD5242
 //    DATE: 2013-10-12
 //     URL: https://github.com/RobTillaart/AD524X
@@ -10,14 +10,19 @@
 
 #include "Arduino.h"
 #include "Wire.h"
+#include "PotGroup.h"
 
 
-#define AD524X_VERSION        (F("0.3.1"))
+#define AD524X_VERSION        (F("0.3.2"))
 
 
 #define AS524X_OK             0
 #define AS524X_ERROR          100
 
+#ifndef AD524X_GROUP_SIZE
+#define AD524X_GROUP_SIZE     8
+#endif
+
 
 class AD524X
 {
@@ -42,6 +47,17 @@ public:
   uint8_t getO1();
   uint8_t getO2();
 
+  // BATCH
+  // values[pmCount()], only changed channels are written.
+  // returns the number of I2C transactions.
+  uint8_t writeValues(const uint8_t * values);
+
+  // RAMP - see AD524XGroup, uses PotRamp
+  void    setTarget(const uint8_t rdac, const uint8_t value);
+  uint8_t getTarget(const uint8_t rdac);
+  void    startRamp();
+  uint8_t rampStep(const uint16_t step, const uint16_t steps);
+
   uint8_t midScaleReset(const uint8_t rdac);
   uint8_t pmCount() { return _pmCount; };
 
@@ -59,6 +75,7 @@ private:
 
   uint8_t _address;
   uint8_t _lastValue[2];
+  PotRamp<2> _ramp;
   uint8_t _O1;
   uint8_t _O2;
 
@@ -80,4 +97,11 @@ public:
 };
 
 
+//////////////////////////////////////////////////////////////
+//
+// GROUP - see PotGroup library
+//
+typedef PotGroup<AD524X, AD524X_GROUP_SIZE> AD524XGroup;
+
+
 // -- END OF FILE --
@@ -0,0 +1,65 @@
+//
+//    FILE: AD524X_group_ramp.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: AD524X demo ramping 4 potentiometers smoothly
+//    DATE: 2021-09-05
+//     URL: https://github.com/RobTillaart/AD524X
+//
+
+#include "AD524X.h"
+
+AD5242 AD01(0x2C);  // AD0 & AD1 == GND
+AD5242 AD02(0x2D);  // AD0 == VCC
+
+AD524XGroup group;
+
+uint32_t start, stop;
+bool up = true;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println(AD524X_VERSION);
+
+  Wire.begin();
+  Wire.setClock(400000);
+
+  AD01.reset();
+  AD02.reset();
+  group.add(&AD01);
+  group.add(&AD02);
+
+  // performance: 4 channels 127 -> 255 as fast as possible
+  group.setTargetAll(255);
+  group.startRamp(128, 0);
+  start = micros();
+  while (group.isRamping()) group.update();
+  stop = micros();
+  Serial.print("128 steps x 4 channels:\t");
+  Serial.println(stop - start);
+  Serial.print("I2C writes:\t");
+  Serial.println(group.getWriteCount());
+  Serial.print("channel updates per second:\t");
+  Serial.println(group.getWriteCount() * 1e6 / (stop - start));
+  delay(100);
+}
+
+
+void loop()
+{
+  group.update();
+
+  if (!group.isRamping())
+  {
+    // 1 second fade, 5 ms per step
+    group.setTargetAll(up ? 0 : 255);
+    up = !up;
+    group.startRamp(200, 5000);
+  }
+}
+
+
+// -- END OF FILE --
@@ -128,6 +128,78 @@ unittest(test_O1_O2)
 }
 
 
+unittest(test_writeValues)
+{
+  AD5242 AD(0x2C);
+  Wire.begin();
+  Wire.resetMocks();
+
+  uint8_t values[2] = { 127, 42 };
+  assertEqual(1, AD.writeValues(values));
+  assertEqual(127, AD.read(0));
+  assertEqual(42, AD.read(1));
+  // no-op writes are skipped
+  assertEqual(0, AD.writeValues(values));
+  assertEqual(2, Wire.getMosi(0x2C)->size());
+}
+
+
+unittest(test_group_ramp)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.begin();
+  Wire.resetMocks();
+
+  AD5242 AD1(0x2C);
+  AD5242 AD2(0x2D);
+  AD5241 AD3(0x2E);
+
+  AD524XGroup group;
+  assertTrue(group.add(&AD1));
+  assertTrue(group.add(&AD2));
+  assertTrue(group.add(&AD3));
+  assertEqual(3, group.count());
+
+  group.setTargetAll(227);
+  group.setTarget(1, 1, 127);        // stays 127 => never written
+  assertEqual(227, AD1.getTarget(0));
+  assertEqual(127, AD2.getTarget(1));
+
+  group.startRamp(100, 1000);
+  assertTrue(group.isRamping());
+  assertEqual(0, group.update());    // not due yet
+
+  state->micros += 1000;
+  assertEqual(4, group.update());    // 2 + 1 + 1 channels
+  assertEqual(128, AD1.read(0));
+
+  state->micros += 200000;
+  group.update();
+  assertFalse(group.isRamping());
+  assertEqual(100, group.getStep());
+  assertEqual(227, AD1.read(1));
+  assertEqual(227, AD3.read(0));
+  assertEqual(127, AD2.read(1));
+  assertEqual(8, group.getWriteCount());
+  assertEqual(0, Wire.getMosi(0x2D)->size() % 2);
+
+  // targets reached => no writes
+  assertEqual(0, group.write());
+
+  // every step of a 100 step ramp of 5 channels
+  group.setTargetAll(27);
+  group.resetWriteCount();
+  group.startRamp(100, 0);
+  while (group.isRamping()) group.update();
+  assertEqual(500, group.getWriteCount());
+
+  // I2C bit times: START + address + cmd + value + STOP
+  float us = (1 + 9 + 18 + 1) * 2.5;
+  fprintf(stderr, "400 KHz channel updates / sec:\t%d\n", (int)(1e6 / us));
+}
+
+
 unittest_main()
 
 // --------
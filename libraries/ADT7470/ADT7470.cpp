@@ -1,7 +1,7 @@
 //
 //    FILE: ADT7470.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: Arduino library for I2C ADT7470 Fan Monitoring
 //     URL: https://github.com/RobTillaart/ADT7470
 //          http://forum.arduino.cc/index.php?topic=363218.0
@@ -12,6 +12,7 @@
 // 0.1.0    2020-07-15  major refactor - first public version
 // 0.1.1    2020-08     fixes after testing
 // 0.1.2    2020-12-09  arduino-ci
+// 0.1.3    2021-06-02  async temperature measurement + readSnapshot()
 
 #include "ADT7470.h"
 
@@ -130,22 +131,72 @@ void ADT7470::powerUp()
 // MEASURE TEMPERATURE
 //
 
-// TODO:
-// make these calls async as waiting up to 2 seconds is an 'eternity'
-// void startConversion();
-// bool conversionReady();
-// int8_t getTemperature(uin8_t idx);
+// blocking version, see async interface below
 int8_t ADT7470::getTemperature(uint8_t idx)
 {
   if (idx >= 10) return 0;
+  startTemperatureMeasurement(10);
+  delay(_measureTime);
+  stopTemperatureMeasurement();
+  return (int8_t) getReg8(ADT7470_TEMP_BASE + idx);
+}
+
+
+void ADT7470::startTemperatureMeasurement(uint8_t sensors)
+{
+  if (sensors == 0) sensors = 1;
+  if (sensors > 10) sensors = 10;
   // 1. Set Register 40 Bit[7] = 1. This starts the temperature measurements.
   setRegMask(ADT7470_CONFIG_REGISTER_1, ADT7470_T05_STB);
   // 2. Wait 200 ms for each TMP05/TMP06 in the loop.
-  delay(2000);  // way to long
+  _measureTime  = (uint32_t)sensors * ADT7470_TMP05_TIME;
+  _measureStart = millis();
+  _measuring    = true;
+}
+
+
+bool ADT7470::temperatureMeasurementReady()
+{
+  if (!_measuring) return false;
+  return (millis() - _measureStart) >= _measureTime;
+}
+
+
+void ADT7470::stopTemperatureMeasurement()
+{
   // 3. Set Register 40 Bit[7] = 0.
-  clrRegMask(ADT7470_CONFIG_REGISTER_1, ADT7470_T05_STB); 
+  clrRegMask(ADT7470_CONFIG_REGISTER_1, ADT7470_T05_STB);
+  _measuring = false;
+}
+
+
+bool ADT7470::readSnapshot(ADT7470_snapshot & snapshot)
+{
+  if (_measuring)
+  {
+    if (!temperatureMeasurementReady()) return false;
+    stopTemperatureMeasurement();
+  }
   // 4. Read the temperature registers.
-  return (int8_t) getReg8(ADT7470_TEMP_BASE + idx);
+  // TEMP_BASE 0x20..0x29 and TACH_BASE 0x2A..0x31 are consecutive.
+  // the tach registers are read low byte first as required (P23).
+  uint8_t buffer[18];
+  if (_read(ADT7470_TEMP_BASE, buffer, 18) != 18) return false;
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    snapshot.temperature[i] = (int8_t)buffer[i];
+  }
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    uint16_t tach = buffer[11 + i * 2];
+    tach <<= 8;
+    tach |= buffer[10 + i * 2];
+    snapshot.tach[i] = tach;
+    snapshot.RPM[i]  = _tach2RPM(tach);
+  }
+  snapshot.timestamp = millis();
+  return true;
 }
 
 int8_t ADT7470::getMaxTemperature()
@@ -277,9 +328,14 @@ uint16_t ADT7470::getTach(uint8_t idx)
 uint32_t ADT7470::getRPM(uint8_t idx)
 {
   if (idx >= 4) return 0;
+  return _tach2RPM(getTach(idx));
+}
+
+
+uint32_t ADT7470::_tach2RPM(uint16_t tach)
+{
   uint32_t clock = 90000UL;
   uint16_t measurementsPerMinute = 60;
-  uint16_t tach = getTach(idx);
   // P23 stalling tach or very slow < 100 ==> 0xFFFF
   if (tach == 0xFFFF) return 0;
   if (tach == 0) return 0;  // explicit prevents divide by zero
@@ -2,7 +2,7 @@
 //
 //    FILE: ADT7470.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 // PURPOSE: Arduino library for I2C ADT7470 Fan Monitoring
 //     URL: https://github.com/RobTillaart/ADT7470
 //          http://forum.arduino.cc/index.php?topic=363218.0
@@ -13,7 +13,7 @@
 #include "Arduino.h"
 #include "Wire.h"
 
-#define ADT7470_LIB_VERSION         "0.1.1"
+#define ADT7470_LIB_VERSION         "0.1.3"
 
 #ifndef ADT7470_TIMEOUT
 #define ADT7470_TIMEOUT             1000
@@ -28,6 +28,22 @@
 #define ADT7470_ADDR_FLOAT          0x2E
 #endif
 
+// Page 13   time needed per TMP05/TMP06 in the daisy chain
+#ifndef ADT7470_TMP05_TIME
+#define ADT7470_TMP05_TIME          200
+#endif
+
+
+// all measurements read in one burst by readSnapshot()
+struct ADT7470_snapshot
+{
+  int8_t   temperature[10];
+  uint16_t tach[4];
+  uint32_t RPM[4];
+  uint32_t timestamp;       // millis() of the readout
+};
+
+
 class ADT7470
 {
 public:
@@ -51,7 +67,20 @@ public:
 
   // MEASURE TEMPERATURE - not tested
   // Page 13    daisy chained specific TMP05 / TMP06 sensors
+  // blocking, takes 2 seconds per call, use async interface below.
   int8_t   getTemperature(uint8_t idx);
+
+  // ASYNC MEASUREMENT
+  // sensors = number of TMP05/TMP06 in the loop, 1..10
+  void     startTemperatureMeasurement(uint8_t sensors = 10);
+  bool     temperatureMeasurementReady();
+  bool     temperatureMeasurementBusy()   { return _measuring; };
+  void     stopTemperatureMeasurement();
+  // returns false if a measurement is still running.
+  // stops a finished measurement and reads all temperature and tach
+  // registers in one I2C burst.
+  bool     readSnapshot(ADT7470_snapshot & snapshot);
+
   int8_t   getMaxTemperature();
   // Page 16
   bool     setTemperatureLimit(uint8_t idx, int8_t low, int8_t high);
@@ -121,7 +150,12 @@ private:
   int     _read(const uint8_t reg, uint8_t *value);
   int     _read(const uint8_t reg, uint8_t *buffer, uint8_t length);
 
+  uint32_t _tach2RPM(uint16_t tach);
+
   uint8_t  _address = 0;
+  bool     _measuring = false;
+  uint32_t _measureStart = 0;
+  uint32_t _measureTime = 0;
 };
 
 // -- END OF FILE --
@@ -0,0 +1,72 @@
+//
+//    FILE: adt7470_snapshot.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: demo ADT7470 async measurement - simple fan control loop
+//    DATE: 2021-06-02
+
+
+#include <Wire.h>
+#include "ADT7470.h"
+
+ADT7470 ADT(ADT7470_ADDR_FLOAT);
+
+ADT7470_snapshot snapshot;
+
+const uint8_t SENSORS = 4;    // TMP05 in daisy chain
+
+
+void setup()
+{
+  Wire.begin();
+
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("ADT7470_LIB_VERSION:\t");
+  Serial.println(ADT7470_LIB_VERSION);
+
+  if (!ADT.isConnected())
+  {
+    Serial.println("Cannot connect ADT7470...\n");
+  }
+  ADT.powerUp();
+  ADT.startMonitoring();
+  ADT.startTemperatureMeasurement(SENSORS);
+}
+
+
+void loop()
+{
+  // other work is not blocked while measuring.
+  if (ADT.readSnapshot(snapshot))
+  {
+    ADT.startTemperatureMeasurement(SENSORS);
+
+    int8_t maxTemp = snapshot.temperature[0];
+    for (uint8_t i = 1; i < SENSORS; i++)
+    {
+      if (snapshot.temperature[i] > maxTemp) maxTemp = snapshot.temperature[i];
+    }
+    // linear fan curve 25 C => 0%  50 C => 100%
+    int pwm = map(constrain(maxTemp, 25, 50), 25, 50, 0, 255);
+    for (uint8_t f = 0; f < 4; f++)
+    {
+      ADT.setPWM(f, pwm);
+    }
+
+    Serial.print(snapshot.timestamp);
+    Serial.print("\t");
+    Serial.print(maxTemp);
+    Serial.print("\t");
+    Serial.print(pwm);
+    for (uint8_t f = 0; f < 4; f++)
+    {
+      Serial.print("\t");
+      Serial.print(snapshot.RPM[f]);
+    }
+    Serial.println();
+  }
+}
+
+
+// -- END OF FILE --
@@ -43,6 +43,50 @@ unittest(test_constructor)
 }
 
 
+unittest(test_async_snapshot)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.resetMocks();
+  auto miso = Wire.getMiso(0x2C);
+
+  ADT7470 ADT(0x2C);
+  ADT.begin();
+
+  miso->push_back(0x01);                        // CONFIG_REGISTER_1
+  ADT.startTemperatureMeasurement(3);
+  assertTrue(ADT.temperatureMeasurementBusy());
+  assertFalse(ADT.temperatureMeasurementReady());
+
+  ADT7470_snapshot snap;
+  state->micros = 599000;
+  assertFalse(ADT.readSnapshot(snap));          // 3 x 200 ms not passed yet
+  state->micros = 600000;
+  assertTrue(ADT.temperatureMeasurementReady());
+
+  miso->push_back(0x81);                        // CONFIG_REGISTER_1
+  for (int i = 0; i < 10; i++) miso->push_back(20 + i);
+  miso->push_back(0x10);                        // tach 0 = 0x2710 = 10000
+  miso->push_back(0x27);
+  for (int i = 0; i < 3; i++)
+  {
+    miso->push_back(0xFF);                      // stalled fans
+    miso->push_back(0xFF);
+  }
+  assertTrue(ADT.readSnapshot(snap));
+  assertFalse(ADT.temperatureMeasurementBusy());
+  assertEqual(0, miso->size());
+
+  assertEqual(20, snap.temperature[0]);
+  assertEqual(29, snap.temperature[9]);
+  assertEqual(10000, snap.tach[0]);
+  assertEqual(540, snap.RPM[0]);
+  assertEqual(0xFFFF, snap.tach[3]);
+  assertEqual(0, snap.RPM[3]);
+  assertEqual(600, snap.timestamp);
+}
+
+
 unittest_main()
 
 // --------
@@ -2,7 +2,7 @@
 //    FILE: AGS02MA.cpp
 //  AUTHOR: Rob Tillaart, Viktor Balint
 //    DATE: 2021-08-12
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: Arduino library for AGS02MA TVOC
 //     URL: https://github.com/RobTillaart/AGS02MA
 
@@ -26,6 +26,8 @@ AGS02MA::AGS02MA(const uint8_t deviceAddress, TwoWire *wire)
   _I2CResetSpeed = 100000;
   _startTime     = 0;
   _lastRead      = 0;
+  _lastAccess    = 0;
+  _speedControl  = true;
   _mode          = 255;
   _status        = AGS02MA_OK;
   _error         = AGS02MA_OK;
@@ -58,14 +60,11 @@ bool AGS02MA::begin()
 
 bool AGS02MA::isConnected()
 {
-#if defined (__AVR__)
-  TWBR = 255;
-#else
-  _wire->setClock(AGS02MA_I2C_CLOCK);
-#endif
+  _setSlowClock();
   _wire->beginTransmission(_address);
   bool rv = ( _wire->endTransmission(true) == 0);
-  _wire->setClock(_I2CResetSpeed);
+  _lastAccess = millis();
+  _resetClock();
   return rv;
 }
 
@@ -134,40 +133,27 @@ bool AGS02MA::setUGM3Mode()
 
 uint32_t AGS02MA::readPPB()
 {
-  uint32_t val = 0xFFFFFFFF;
-  _lastRead = millis();
-  if (_readRegister(AGS02MA_DATA))
-  {
-    _status = _buffer[0];
-    val =  _buffer[1] * 65536UL;
-    val += _buffer[2] * 256;
-    val += _buffer[3];
-    if (_CRC8(_buffer, 5) != 0)
-    {
-      _error = AGS02MA_CRC_ERROR;
-    }
-  }
-  return val;
+  return _readData();
 }
 
 
 uint32_t AGS02MA::readUGM3()
 {
-  // TODO identical code wise to PPB, can be merged into one.
-  uint32_t val = 0xFFFFFFFF;
+  return _readData();
+}
+
+
+bool AGS02MA::requestData()
+{
+  return _requestRegister(AGS02MA_DATA);
+}
+
+
+uint32_t AGS02MA::fetchData()
+{
   _lastRead = millis();
-  if (_readRegister(AGS02MA_DATA))
-  {
-    _status = _buffer[0];
-    val = _buffer[1] * 65536UL;
-    val += _buffer[2] * 256;
-    val += _buffer[3];
-    if (_CRC8(_buffer, 5) != 0)
-    {
-      _error = AGS02MA_CRC_ERROR;
-    }
-  }
-  return val;
+  if (!_fetchRegister()) return 0xFFFFFFFF;
+  return _decodeData();
 }
 
 
@@ -194,40 +180,95 @@ int AGS02MA::lastError()
 //
 // PRIVATE
 //
+// blocking version of requestData() + fetchData(),
+// one slow clock period for both steps.
+uint32_t AGS02MA::_readData()
+{
+  _lastRead = millis();
+  if (!_readRegister(AGS02MA_DATA)) return 0xFFFFFFFF;
+  return _decodeData();
+}
+
+
+uint32_t AGS02MA::_decodeData()
+{
+  _status = _buffer[0];
+  uint32_t val = _buffer[1] * 65536UL;
+  val += _buffer[2] * 256;
+  val += _buffer[3];
+  if (_CRC8(_buffer, 5) != 0)
+  {
+    _error = AGS02MA_CRC_ERROR;
+  }
+  return val;
+}
+
+
 bool AGS02MA::_readRegister(uint8_t reg)
 {
-#if defined (__AVR__)
-  TWBR = 255;
-#else
-  _wire->setClock(AGS02MA_I2C_CLOCK);
-#endif
+  _setSlowClock();
+  bool rv = _sendRegister(reg);
+  if (rv)
+  {
+    delay(AGS02MA_ACCESS_DELAY);
+    rv = _receiveRegister();
+    delay(AGS02MA_ACCESS_DELAY);
+  }
+  _resetClock();
+  return rv;
+}
+
+
+// async steps, each sets and resets the clock.
+bool AGS02MA::_requestRegister(uint8_t reg)
+{
+  _setSlowClock();
+  bool rv = _sendRegister(reg);
+  _resetClock();
+  return rv;
+}
+
+
+bool AGS02MA::_fetchRegister()
+{
+  _setSlowClock();
+  bool rv = _receiveRegister();
+  _resetClock();
+  return rv;
+}
+
+
+// raw transactions, caller handles the clock.
+bool AGS02MA::_sendRegister(uint8_t reg)
+{
   _wire->beginTransmission(_address);
   _wire->write(reg);
   _error = _wire->endTransmission(true);
-  delay(30);
-  if (_wire->requestFrom(_address, (uint8_t)5) != 5)
+  _lastAccess = millis();
+  return (_error == 0);
+}
+
+
+bool AGS02MA::_receiveRegister()
+{
+  uint8_t n = _wire->requestFrom(_address, (uint8_t)5);
+  _lastAccess = millis();
+  if (n != 5)
   {
     _error = AGS02MA_ERROR;
-    _wire->setClock(_I2CResetSpeed);
     return false;
   }
   for (int i = 0; i < 5; i++)
   {
     _buffer[i] = _wire->read();
   }
-  delay(30);
-  _wire->setClock(_I2CResetSpeed);
   return true;
 }
 
 
 bool AGS02MA::_writeRegister(uint8_t reg)
 {
-#if defined (__AVR__)
-  TWBR = 255;
-#else
-  _wire->setClock(AGS02MA_I2C_CLOCK);
-#endif
+  _setSlowClock();
   _wire->beginTransmission(_address);
   _wire->write(reg);
   for (int i = 0; i < 5; i++)
@@ -235,12 +276,31 @@ bool AGS02MA::_writeRegister(uint8_t reg)
     _wire->write(_buffer[i]);
   }
   _error = _wire->endTransmission(true);
-  delay(30);
-  _wire->setClock(_I2CResetSpeed);
+  delay(AGS02MA_ACCESS_DELAY);
+  _lastAccess = millis();
+  _resetClock();
   return (_error == 0);
 }
 
 
+void AGS02MA::_setSlowClock()
+{
+  if (!_speedControl) return;
+#if defined (__AVR__)
+  TWBR = 255;
+#else
+  _wire->setClock(AGS02MA_I2C_CLOCK);
+#endif
+}
+
+
+void AGS02MA::_resetClock()
+{
+  if (!_speedControl) return;
+  _wire->setClock(_I2CResetSpeed);
+}
+
+
 uint8_t AGS02MA::_CRC8(uint8_t * buf, uint8_t size)
 {
   uint8_t crc = 0xFF;  // start value
@@ -3,7 +3,7 @@
 //    FILE: AGS02MA.h
 //  AUTHOR: Rob Tillaart, Viktor Balint
 //    DATE: 2021-08-12
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: Arduino library for AGS02MA TVOC
 //     URL: https://github.com/RobTillaart/AGS02MA
 //
@@ -13,7 +13,7 @@
 #include "Wire.h"
 
 
-#define AGS02MA_LIB_VERSION         (F("0.1.1"))
+#define AGS02MA_LIB_VERSION         (F("0.1.2"))
 
 #define AGS02MA_OK                  0
 #define AGS02MA_ERROR               -10
@@ -22,6 +22,9 @@
 
 #define AGS02MA_I2C_CLOCK           30000
 
+// minimum time in milliseconds between I2C accesses
+#define AGS02MA_ACCESS_DELAY        30
+
 
 class AGS02MA
 {
@@ -47,6 +50,10 @@ public:
   // as the device operates at very low bus speed.
   void     setI2CResetSpeed(uint32_t s) { _I2CResetSpeed = s; };
   uint32_t getI2CResetSpeed() { return _I2CResetSpeed; };
+  // false => library does not change the I2C clock,
+  // e.g. when an I2CBusManager selects the speed per device.
+  void     setSpeedControl(bool control) { _speedControl = control; };
+  bool     getSpeedControl() { return _speedControl; };
 
   // to be called after at least 5 minutes in fresh air.
   bool     zeroCalibration();
@@ -60,6 +67,13 @@ public:
   uint32_t readPPB();
   uint32_t readUGM3();
 
+  // ASYNC READ - no blocking delay()
+  // requestData() sends the register, fetchData() reads the value
+  // in the mode set. Both need isReady() to be true first.
+  bool     requestData();
+  uint32_t fetchData();
+  bool     isReady() { return (millis() - _lastAccess) >= AGS02MA_ACCESS_DELAY; };
+
   uint32_t lastRead() { return _lastRead; };
   int      lastError();
   uint8_t  lastStatus() { return _status; };
@@ -68,10 +82,21 @@ public:
 private:
   bool     _readRegister(uint8_t reg);
   bool     _writeRegister(uint8_t reg);
+  bool     _requestRegister(uint8_t reg);
+  bool     _fetchRegister();
+  bool     _sendRegister(uint8_t reg);
+  bool     _receiveRegister();
+  uint32_t _readData();
+  uint32_t _decodeData();
+
+  void     _setSlowClock();
+  void     _resetClock();
 
   uint32_t _I2CResetSpeed = 100000;
   uint32_t _startTime     = 0;
   uint32_t _lastRead      = 0;
+  uint32_t _lastAccess    = 0;
+  bool     _speedControl  = true;
   uint8_t  _address       = 0;
   uint8_t  _mode          = 255;
   uint8_t  _status        = 0;
@@ -0,0 +1,70 @@
+//
+//    FILE: AGS02MA_async.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: test application - read without blocking delay()
+//    DATE: 2021-09-01
+//     URL: https://github.com/RobTillaart/AGS02MA
+//
+
+#include "AGS02MA.h"
+
+
+AGS02MA AGS(26);
+
+uint8_t  state    = 0;
+uint32_t lastTime = 0;
+uint32_t loops    = 0;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+
+  Wire.begin();
+
+  Serial.print("AGS02MA_LIB_VERSION: ");
+  Serial.println(AGS02MA_LIB_VERSION);
+  Serial.println();
+
+  bool b = AGS.begin();
+  Serial.print("BEGIN:\t");
+  Serial.println(b);
+
+  b = AGS.setPPBMode();
+  Serial.print("MODE:\t");
+  Serial.println(b);
+}
+
+
+void loop()
+{
+  loops++;
+
+  if ((state == 0) && AGS.isReady() && (millis() - lastTime >= 3000))
+  {
+    lastTime = millis();
+    AGS.requestData();
+    state = 1;
+  }
+  if ((state == 1) && AGS.isReady())
+  {
+    uint32_t value = AGS.fetchData();
+    state = 0;
+
+    Serial.print("PPB:\t");
+    Serial.print(value);
+    Serial.print("\t");
+    Serial.print(AGS.lastStatus(), HEX);
+    Serial.print("\t");
+    Serial.print(AGS.lastError(), HEX);
+    // other work done while waiting
+    Serial.print("\tloops: ");
+    Serial.println(loops);
+    loops = 0;
+  }
+}
+
+
+// -- END OF FILE --
@@ -81,6 +81,43 @@ unittest(test_mode)
 }
 
 
+unittest(test_async_read)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(26);
+  auto miso = Wire.getMiso(26);
+
+  AGS02MA AGS(26);
+  assertTrue(AGS.begin());
+  assertTrue(AGS.getSpeedControl());
+  AGS.setSpeedControl(false);
+  assertFalse(AGS.getSpeedControl());
+
+  assertFalse(AGS.isReady());         // isConnected() was just called
+  state->micros += 30000;
+  assertTrue(AGS.isReady());
+  assertTrue(AGS.requestData());
+  assertEqual(1, mosi->size());
+  assertFalse(AGS.isReady());         // no delay(), caller waits
+  state->micros += 30000;
+  assertTrue(AGS.isReady());
+
+  // status 0, 0x000123 = 291 PPB, CRC
+  miso->push_back(0x00);
+  miso->push_back(0x00);
+  miso->push_back(0x01);
+  miso->push_back(0x23);
+  miso->push_back(0xF6);
+  assertEqual(291, AGS.fetchData());
+  assertEqual(0, AGS.lastError());
+  assertEqual(0, AGS.lastStatus());
+  assertFalse(AGS.isReady());
+  assertEqual(60, AGS.lastRead());
+}
+
+
 
 unittest_main()
 
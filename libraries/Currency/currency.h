@@ -3,104 +3,232 @@
 //
 //    FILE: currency.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.1
+// VERSION: 0.2.0
 // PURPOSE: Currency library for Arduino
 //     URL: https://github.com/RobTillaart/Currency
 
 //  HISTORY
 //  0.1.0   2021-02-27  initial version
 //  0.1.1   2021-05-27  fix library.properties
+//  0.2.0   2021-09-21  reentrant currency_r(), currency64_r(), bulk currency_n(), currency64_n()
+//                      one pass, two digit lookup, currency() + currency64() use these.
 
 
 #include "Arduino.h"
 
 
-#define CURRENCY_VERSION        (F("0.1.1"))
+#define CURRENCY_VERSION        (F("0.2.0"))
+
+// fits any int64_t with separators, sign, symbol and '\0'
+#define CURRENCY_BUFFERSIZE     32
 
 
-// TODO 
-// optimize this 99% same code currency - currency64  
-// print to string and "merge" with formatters?
-//
 // ALT-0165 = ¥
 // ALT-0128 = €
 // U+20BF   = Bitcoin
 
 
-char * currency(int32_t value, int decimals, char dsep, char tsep, char sym)
+// two digits per lookup, halves the number of (32/64 bit) divisions.
+static const char _currencyPairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+
+// writes the digits of v right aligned, ending just before end.
+// returns the number of digits.
+static uint8_t _currencyDigits(char * end, uint32_t v)
 {
-  static char tmp[16];
-  int idx = 0;
+  char * p = end;
+  while (v >= 100)
+  {
+    uint32_t q = v / 100;
+    uint8_t r = v - q * 100;
+    v = q;
+    p -= 2;
+    p[0] = _currencyPairs[r * 2];
+    p[1] = _currencyPairs[r * 2 + 1];
+  }
+  if (v >= 10)
+  {
+    p -= 2;
+    p[0] = _currencyPairs[v * 2];
+    p[1] = _currencyPairs[v * 2 + 1];
+  }
+  else
+  {
+    *--p = '0' + v;
+  }
+  return end - p;
+}
 
-  int32_t v = value;
-  bool neg = v < 0;
-  if (neg) v = -v;
 
-  int p = -decimals; // decimal places
+// 64 bit divisions only as long as the value does not fit in 32 bit.
+static uint8_t _currencyDigits64(char * end, uint64_t v)
+{
+  char * p = end;
+  while (v > 0xFFFFFFFFULL)
+  {
+    uint64_t q = v / 100;
+    uint8_t r = v - q * 100;
+    v = q;
+    p -= 2;
+    p[0] = _currencyPairs[r * 2];
+    p[1] = _currencyPairs[r * 2 + 1];
+  }
+  p -= _currencyDigits(p, v);
+  return end - p;
+}
+
 
-  while ((p < 1) || ( v > 0))
+// length is known up front so the output is written forward in one pass.
+// returns the length, or 0 if it does not fit in size (buf = "" then).
+static uint8_t _currencyFormat(char * buf, uint8_t size, const char * digits, uint8_t nd,
+                               bool neg, uint8_t decimals, char dsep, char tsep, char sym)
+{
+  uint16_t total = (nd > decimals) ? nd : decimals + 1;   // incl. leading zeros
+  uint16_t ni    = total - decimals;                      // integer digits
+  uint16_t len   = 2 + total + (ni - 1) / 3 + ((decimals > 0) ? 1 : 0);
+  if (len >= size)
   {
-    // separators
-    if ((p == 0) && (decimals > 0) ) tmp[idx++] = dsep;
-    if ((p > 0) && (p % 3 == 0) && (v > 0)) tmp[idx++] = tsep;
-
-    int d = (v % 10) + '0';
-    v /= 10;
-    tmp[idx++] = d;
-    p++;
+    if (size > 0) buf[0] = '\0';
+    return 0;
   }
-  if (neg) tmp[idx++] = '-';
-  else     tmp[idx++] = ' ';
-  tmp[idx++] = sym;
-  tmp[idx] = 0;
-
-  // reverse string
-  int len = strlen(tmp);
-  for (int i = 0; i < len / 2; i++)
+
+  char * p = buf;
+  *p++ = sym;
+  *p++ = neg ? '-' : ' ';
+  if (nd > decimals)
   {
-    char c = tmp[i];
-    tmp[i] = tmp[len - i - 1];
-    tmp[len - i - 1] = c;
+    // integer part in groups of 3, the first group has 1..3 digits
+    uint8_t group = ni % 3;
+    if (group == 0) group = 3;
+    memcpy(p, digits, group);
+    p += group;
+    digits += group;
+    for (ni -= group; ni > 0; ni -= 3)
+    {
+      *p++ = tsep;
+      memcpy(p, digits, 3);
+      p += 3;
+      digits += 3;
+    }
+    if (decimals > 0)
+    {
+      *p++ = dsep;
+      memcpy(p, digits, decimals);
+      p += decimals;
+    }
   }
-  return tmp;
+  else
+  {
+    // 0.00ddd
+    *p++ = '0';
+    *p++ = dsep;
+    memset(p, '0', decimals - nd);
+    p += decimals - nd;
+    memcpy(p, digits, nd);
+    p += nd;
+  }
+  *p = '\0';
+  return len;
 }
 
 
-char * currency64(int64_t value, int decimals, char dsep, char tsep, char sym)
+//
+//  REENTRANT - caller provides the buffer
+//
+//  returns the length of the string, 0 if buf is too small.
+//
+uint8_t currency_r(char * buf, uint8_t size, int32_t value, uint8_t decimals, char dsep, char tsep, char sym)
 {
-  static char tmp[32];
-  int idx = 0;
+  char tmp[10];
+  bool neg = value < 0;
+  uint32_t v = neg ? 0 - (uint32_t)value : value;
+  uint8_t nd = _currencyDigits(tmp + 10, v);
+  return _currencyFormat(buf, size, tmp + 10 - nd, nd, neg, decimals, dsep, tsep, sym);
+}
+
 
-  int64_t v = value;
-  bool neg = v < 0;
-  if (neg) v = -v;
+uint8_t currency64_r(char * buf, uint8_t size, int64_t value, uint8_t decimals, char dsep, char tsep, char sym)
+{
+  char tmp[20];
+  bool neg = value < 0;
+  uint64_t v = neg ? 0 - (uint64_t)value : value;
+  uint8_t nd = _currencyDigits64(tmp + 20, v);
+  return _currencyFormat(buf, size, tmp + 20 - nd, nd, neg, decimals, dsep, tsep, sym);
+}
 
-  int p = -decimals; // decimal places
 
-  while ((p < 1) || ( v > 0))
+//
+//  BULK - e.g. a column of a table
+//
+//  every value is followed by rowsep, buf is always '\0' terminated.
+//  returns the number of values written, a value that does not fit
+//  is not written, so the caller can continue with values + count.
+//
+uint16_t currency_n(char * buf, uint16_t size, const int32_t * values, uint16_t n,
+                    uint8_t decimals, char dsep, char tsep, char sym, char rowsep = '\n')
+{
+  if (size == 0) return 0;
+  uint16_t pos = 0;
+  uint16_t i = 0;
+  for (; i < n; i++)
   {
-    // separators
-    if ((p == 0) && (decimals > 0) ) tmp[idx++] = dsep;
-    if ((p > 0) && (p % 3 == 0) && (v > 0)) tmp[idx++] = tsep;
-
-    int d = (v % 10) + '0';
-    v /= 10;
-    tmp[idx++] = d;
-    p++;
+    uint16_t room = size - pos - 1;   // keep 1 for rowsep
+    if (room > 255) room = 255;
+    uint8_t len = currency_r(buf + pos, room, values[i], decimals, dsep, tsep, sym);
+    if (len == 0) break;
+    pos += len;
+    buf[pos++] = rowsep;
   }
-  if (neg) tmp[idx++] = '-';
-  else     tmp[idx++] = ' ';
-  tmp[idx++] = sym;
-  tmp[idx] = 0;
-
-  // reverse string
-  int len = strlen(tmp);
-  for (int i = 0; i < len / 2; i++)
+  buf[pos] = '\0';
+  return i;
+}
+
+
+uint16_t currency64_n(char * buf, uint16_t size, const int64_t * values, uint16_t n,
+                      uint8_t decimals, char dsep, char tsep, char sym, char rowsep = '\n')
+{
+  if (size == 0) return 0;
+  uint16_t pos = 0;
+  uint16_t i = 0;
+  for (; i < n; i++)
   {
-    char c = tmp[i];
-    tmp[i] = tmp[len - i - 1];
-    tmp[len - i - 1] = c;
+    uint16_t room = size - pos - 1;
+    if (room > 255) room = 255;
+    uint8_t len = currency64_r(buf + pos, room, values[i], decimals, dsep, tsep, sym);
+    if (len == 0) break;
+    pos += len;
+    buf[pos++] = rowsep;
   }
+  buf[pos] = '\0';
+  return i;
+}
+
+
+//
+//  STATIC BUFFER - result must be printed / copied before the next call.
+//
+char * currency(int32_t value, int decimals, char dsep, char tsep, char sym)
+{
+  static char tmp[16];
+  currency_r(tmp, sizeof(tmp), value, decimals, dsep, tsep, sym);
+  return tmp;
+}
+
+
+char * currency64(int64_t value, int decimals, char dsep, char tsep, char sym)
+{
+  static char tmp[CURRENCY_BUFFERSIZE];
+  currency64_r(tmp, sizeof(tmp), value, decimals, dsep, tsep, sym);
   return tmp;
 }
 
@@ -0,0 +1,124 @@
+//
+//    FILE: currency_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: compare 0.1.1 formatting with currency_r() and currency_n()
+//    DATE: 2021-09-21
+//     URL: https://github.com/RobTillaart/Currency
+
+
+#include "Arduino.h"
+#include "currency.h"
+
+
+#define ROWS      50
+
+int32_t prices[ROWS];
+char    table[ROWS * 16];
+
+uint32_t start, duration;
+volatile char sink;
+
+
+// reference: currency() of version 0.1.1, reverse in static buffer.
+char * currency_011(int32_t value, int decimals, char dsep, char tsep, char sym)
+{
+  static char tmp[16];
+  int idx = 0;
+
+  int32_t v = value;
+  bool neg = v < 0;
+  if (neg) v = -v;
+
+  int p = -decimals;
+  while ((p < 1) || ( v > 0))
+  {
+    if ((p == 0) && (decimals > 0) ) tmp[idx++] = dsep;
+    if ((p > 0) && (p % 3 == 0) && (v > 0)) tmp[idx++] = tsep;
+    int d = (v % 10) + '0';
+    v /= 10;
+    tmp[idx++] = d;
+    p++;
+  }
+  if (neg) tmp[idx++] = '-';
+  else     tmp[idx++] = ' ';
+  tmp[idx++] = sym;
+  tmp[idx] = 0;
+
+  int len = strlen(tmp);
+  for (int i = 0; i < len / 2; i++)
+  {
+    char c = tmp[i];
+    tmp[i] = tmp[len - i - 1];
+    tmp[len - i - 1] = c;
+  }
+  return tmp;
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("CURRENCY_VERSION: ");
+  Serial.println(CURRENCY_VERSION);
+  Serial.println();
+
+  for (int i = 0; i < ROWS; i++)
+  {
+    prices[i] = random(-100000000, 100000000);
+  }
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++)
+  {
+    sink = currency_011(prices[i], 2, '.', ',', '$')[2];
+  }
+  duration = micros() - start;
+  Serial.print("0.1.1 currency():\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++)
+  {
+    char buf[CURRENCY_BUFFERSIZE];
+    currency_r(buf, sizeof(buf), prices[i], 2, '.', ',', '$');
+    sink = buf[2];
+  }
+  duration = micros() - start;
+  Serial.print("currency_r():\t\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+
+  delay(10);
+  start = micros();
+  uint16_t count = currency_n(table, sizeof(table), prices, ROWS, 2, '.', ',', '$');
+  duration = micros() - start;
+  Serial.print("currency_n():\t\t");
+  Serial.println(1.0 * duration / count, 2);
+  Serial.println("(us per value)\n");
+
+  // verify
+  for (int i = 0; i < ROWS; i++)
+  {
+    char buf[CURRENCY_BUFFERSIZE];
+    currency_r(buf, sizeof(buf), prices[i], 2, '.', ',', '$');
+    if (strcmp(buf, currency_011(prices[i], 2, '.', ',', '$')) != 0)
+    {
+      Serial.print("DIFF:\t");
+      Serial.println(prices[i]);
+    }
+  }
+
+  Serial.print(table);
+  Serial.println("\nDone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
@@ -159,6 +159,49 @@ unittest(wrappersdouble)
 }
 
 
+unittest(reentrant)
+{
+  char a[CURRENCY_BUFFERSIZE];
+  char b[CURRENCY_BUFFERSIZE];
+
+  // two buffers in one expression
+  assertEqual(14, currency_r(a, sizeof(a), 999999999, 2, '.', ',', '$'));
+  assertEqual(14, currency_r(b, sizeof(b), -999999999, 2, ',', '.', 'E'));
+  assertEqual(0, strcmp("$ 9,999,999.99", a));
+  assertEqual(0, strcmp("E-9.999.999,99", b));
+
+  assertEqual(7, currency_r(a, sizeof(a), 5, 3, '.', ',', '$'));
+  assertEqual(0, strcmp("$ 0.005", a));
+  assertEqual(5, currency_r(a, sizeof(a), 123, 0, '.', ',', '$'));
+  assertEqual(0, strcmp("$ 123", a));
+  assertEqual(0, strcmp("$-21,474,836.48", (currency_r(a, sizeof(a), INT32_MIN, 2, '.', ',', '$'), a)));
+  assertEqual(0, strcmp("$-92,233,720,368,547,758.08", (currency64_r(a, sizeof(a), INT64_MIN, 2, '.', ',', '$'), a)));
+
+  // too small => empty string
+  assertEqual(0, currency_r(a, 10, 123456, 2, '.', ',', '$'));
+  assertEqual(0, strlen(a));
+  assertEqual(10, currency_r(a, 11, 123456, 2, '.', ',', '$'));
+}
+
+
+unittest(bulk)
+{
+  int32_t values[4] = { 1, -250, 99999, 123456789 };
+  int64_t values64[2] = { 100000000000LL, -5 };
+  char buf[64];
+
+  assertEqual(4, currency_n(buf, sizeof(buf), values, 4, 2, '.', ',', '$'));
+  assertEqual(0, strcmp("$ 0.01\n$-2.50\n$ 999.99\n$ 1,234,567.89\n", buf));
+
+  // only complete values are written
+  assertEqual(2, currency_n(buf, 20, values, 4, 2, '.', ',', '$', ';'));
+  assertEqual(0, strcmp("$ 0.01;$-2.50;", buf));
+
+  assertEqual(2, currency64_n(buf, sizeof(buf), values64, 2, 2, ',', '.', 'E', ' '));
+  assertEqual(0, strcmp("E 1.000.000.000,00 E-0,05 ", buf));
+}
+
+
 unittest_main()
 
 // --------
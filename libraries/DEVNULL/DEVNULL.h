@@ -2,29 +2,90 @@
 //
 //    FILE: DEVNULL.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: Arduino library for a /dev/null stream - usefull for testing
 //     URL: https://github.com/RobTillaart/DEVNULL
 //
 // HISTORY:
 // 0.1.0    2020-06-23  initial version
 // 0.1.1    2020-12-18  add arduino-ci + 
+// 0.1.2    2021-09-08  add bulk write(), statistics and optional hash
 
 #include "Arduino.h"
 
+
+#define DEVNULL_LIB_VERSION         (F("0.1.2"))
+
+
 class DEVNULL : public Stream
 {
 public:
-  DEVNULL() {};
+  DEVNULL() { reset(); };
 
   int    available() { return 0; };
   int    peek()      { return EOF; };
   int    read()      { return EOF; };
   void   flush()     { return; };  // placeholder to keep CI happy
-  size_t write(const uint8_t data) { _bottomLessPit = data; return 1; };
+
+  using  Print::write;
+
+  size_t write(const uint8_t data)
+  {
+    _bottomLessPit = data;
+    _bytes++;
+    _singleCalls++;
+    if (_hashing) _hash = (_hash ^ data) * 16777619UL;
+    return 1;
+  };
+
+  size_t write(const uint8_t * buffer, size_t size)
+  {
+    _bytes += size;
+    _bulkCalls++;
+    if (_hashing)
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        _hash = (_hash ^ buffer[i]) * 16777619UL;
+      }
+    }
+    return size;
+  };
+
+
+  // STATISTICS
+  // reset counters, hash and starts the time for bytesPerSecond()
+  void     reset()
+  {
+    _bytes       = 0;
+    _singleCalls = 0;
+    _bulkCalls   = 0;
+    _hash        = 2166136261UL;   // FNV-1a offset basis
+    _start       = micros();
+  };
+  uint32_t bytes()       { return _bytes; };
+  uint32_t singleCalls() { return _singleCalls; };
+  uint32_t bulkCalls()   { return _bulkCalls; };
+  float    bytesPerSecond()
+  {
+    uint32_t duration = micros() - _start;
+    if (duration == 0) return 0;
+    return _bytes * 1e6 / duration;
+  };
+
+  // FNV-1a 32 bit hash of all bytes written since reset()
+  void     setHash(bool hashing) { _hashing = hashing; };
+  bool     getHash()  { return _hashing; };
+  uint32_t hash()     { return _hash; };
 
 private:
   uint8_t  _bottomLessPit;
+  uint32_t _bytes;
+  uint32_t _singleCalls;
+  uint32_t _bulkCalls;
+  uint32_t _start;
+  uint32_t _hash;
+  bool     _hashing = false;
 };
 
 // -- END OF FILE --
@@ -0,0 +1,69 @@
+//
+//    FILE: DEVNULL_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: use DEVNULL as benchmark sink for print paths
+//    DATE: 2021-09-08
+//    (c) : MIT
+//
+
+#include "DEVNULL.h"
+
+DEVNULL dn;
+
+
+void report(const char * name)
+{
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(dn.bytes());
+  Serial.print("\t");
+  Serial.print(dn.singleCalls());
+  Serial.print("\t");
+  Serial.print(dn.bulkCalls());
+  Serial.print("\t");
+  Serial.print(dn.bytesPerSecond(), 0);
+  Serial.print("\t");
+  Serial.println(dn.hash(), HEX);
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println(DEVNULL_LIB_VERSION);
+  Serial.println();
+  Serial.println("TEST\tBYTES\tSINGLE\tBULK\tBYTES/S\tHASH");
+
+  dn.setHash(true);
+
+  dn.reset();
+  for (int i = 0; i < 1000; i++) dn.print("hello world");
+  report("char*");
+
+  dn.reset();
+  for (int i = 0; i < 1000; i++) dn.print(i);
+  report("int");
+
+  dn.reset();
+  for (int i = 0; i < 1000; i++) dn.print(i * PI, 4);
+  report("float");
+
+  dn.reset();
+  for (int i = 0; i < 1000; i++) dn.println();
+  report("println");
+
+  // any library that uses a Print* can be measured the same way, e.g.
+  // XMLWriter XML(&dn);  ... report("XMLWriter");
+
+  Serial.println("\nDone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
@@ -47,6 +47,58 @@ unittest(test_all)
   assertEqual(11,  dn.print("hello world"));
 }
 
+
+unittest(test_statistics)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  DEVNULL dn;
+  assertEqual(0, dn.bytes());
+  assertEqual(11, dn.print("hello world"));
+  assertEqual(11, dn.bytes());
+  assertEqual(1, dn.bulkCalls());
+  assertEqual(0, dn.singleCalls());
+
+  dn.write('a');
+  dn.write('b');
+  assertEqual(13, dn.bytes());
+  assertEqual(2, dn.singleCalls());
+
+  uint8_t buffer[100];
+  assertEqual(100, dn.write(buffer, 100));
+  assertEqual(113, dn.bytes());
+  assertEqual(2, dn.bulkCalls());
+
+  state->micros += 1000;
+  assertEqualFloat(113000.0, dn.bytesPerSecond(), 1);
+
+  dn.reset();
+  assertEqual(0, dn.bytes());
+  assertEqual(0, dn.singleCalls());
+  assertEqual(0, dn.bulkCalls());
+}
+
+
+unittest(test_hash)
+{
+  DEVNULL dn;
+  assertFalse(dn.getHash());
+  dn.setHash(true);
+  assertTrue(dn.getHash());
+
+  // FNV-1a of "hello world"
+  dn.print("hello world");
+  assertEqual(0xD58B3FA7, dn.hash());
+
+  // same hash for single byte writes
+  dn.reset();
+  const char * str = "hello world";
+  for (int i = 0; i < 11; i++) dn.write(str[i]);
+  assertEqual(0xD58B3FA7, dn.hash());
+}
+
+
 unittest_main()
 
 // --------
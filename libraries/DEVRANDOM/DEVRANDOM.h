@@ -2,7 +2,7 @@
 //
 //    FILE: DEVRANDOM.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.2.0
 // PURPOSE: Arduino library for a /dev/random stream - usefull for testing
 //     URL: https://github.com/RobTillaart/DEVRANDOM
 //
@@ -11,12 +11,14 @@
 //  0.1.1   2020-12-18  add arduino-ci + unit tests
 //                      + getMode() + flush()
 //  0.1.2   2021-01-15  add constructors with seed.
+//  0.2.0   2021-09-23  entropy pool with Threefry (ARX) mixing, counter mode output,
+//                      readBytes(), write(buffer, size), same output on all platforms.
 
 
 #include "Arduino.h"
 
 
-#define  DEVRANDOM_LIB_VERSION      (F("0.1.2"))
+#define  DEVRANDOM_LIB_VERSION      (F("0.2.0"))
 
 
 #define  DEVRANDOM_MODE_SW           0
@@ -24,115 +26,269 @@
 #define  DEVRANDOM_MODE_AR           2
 
 
+// ENTROPY POOL
+//
+// all input (write(), print(), HW / AR noise) is absorbed in a 16 byte
+// block. A full block is compressed into the 128 bit pool:
+//     pool = F(key = block, counter = pool) ^ pool       (Davies-Meyer)
+// output is generated in counter mode, 16 bytes per call:
+//     block = F(key = pool, counter = n++)
+// F() = Threefry-4x32-20, an ARX (add rotate xor) block function,
+// see Salmon et al, "Parallel random numbers: as easy as 1, 2, 3", 2011.
+// No tables, no multiply, no division, same output on all platforms.
+//
+// HW and AR mode absorb 16 raw noise bytes (128 reads) per output block,
+// so the output never has more bits than the noise source delivered.
+
+
 class DEVRANDOM : public Stream
 {
 public:
   DEVRANDOM()
   {
-    _seed = 0;
-    _next = random(256);
-    _mode = 0;
-    _pin = 0;
+    _init();
   };
 
   DEVRANDOM(const char * str)
   {
+    _init();
     this->print(str);
-    _next = random(256);
-    _mode = 0;
-    _pin = 0;
   };
 
   DEVRANDOM(const uint32_t val)
   {
-     this->print(val);
-    _next = random(256);
-    _mode = 0;
-    _pin = 0;
+    _init();
+    this->print(val);
   };
 
   DEVRANDOM(const float val)
   {
+    _init();
     this->print(val, 6);
-    _next = random(256);
-    _mode = 0;
-    _pin = 0;
   };
 
 
   int available() { return 1; };
 
 
-  int peek()      { return _next; };
-  int read()      
+  int peek()
   {
-    uint8_t x = _next;
-    _next = _rnd();
-    return x;
+    if (_pos >= 16) _refill();
+    return _out[_pos];
+  };
+
+
+  int read()
+  {
+    if (_pos >= 16) _refill();
+    return _out[_pos++];
+  };
+
+
+  // whole buffers, no virtual call per byte.
+  size_t readBytes(uint8_t * buffer, size_t length)
+  {
+    size_t n = length;
+    while (n > 0)
+    {
+      if (_pos >= 16) _refill();
+      size_t len = 16 - _pos;
+      if (len > n) len = n;
+      memcpy(buffer, &_out[_pos], len);
+      _pos += len;
+      buffer += len;
+      n -= len;
+    }
+    return length;
+  };
+
+
+  size_t readBytes(char * buffer, size_t length)
+  {
+    return readBytes((uint8_t *) buffer, length);
   };
 
 
   // keep CI happy as parent class flush is virtual.
-  void flush() {};  
+  void flush() {};
 
 
+  // data is used to reseed, effective from the next byte read.
+  using Print::write;
   size_t write(const uint8_t data)
   {
-    _seed = (_seed << 8) + data;
-    randomSeed(_seed);
+    _absorb(data);
+    _pending = true;
+    _pos = 16;
     return 1;
   };
 
 
-  void useAR(uint8_t pin) { _mode = 2; _pin = pin; };
-  void useHW(uint8_t pin) { _mode = 1; _pin = pin; pinMode(_pin, INPUT); };
-  void useSW()            { _mode = 0; };
+  size_t write(const uint8_t * buffer, size_t size)
+  {
+    for (size_t i = 0; i < size; i++) _absorb(buffer[i]);
+    _pending = true;
+    _pos = 16;
+    return size;
+  };
+
+
+  // a mode change is effective from the next byte read.
+  void useAR(uint8_t pin) { _mode = DEVRANDOM_MODE_AR; _pin = pin; _pos = 16; };
+  void useHW(uint8_t pin) { _mode = DEVRANDOM_MODE_HW; _pin = pin; _pos = 16; pinMode(_pin, INPUT); };
+  void useSW()            { _mode = DEVRANDOM_MODE_SW; _pos = 16; };
 
 
   uint8_t getMode() { return _mode; };
 
 
 private:
-  uint8_t  _next;
-  uint32_t _seed;
+  uint32_t _pool[4];
+  uint32_t _counter[2];
+  uint8_t  _in[16];
+  uint8_t  _inCount;
+  bool     _pending;
+  uint8_t  _out[16];
+  uint8_t  _pos;
   uint8_t  _mode;
   uint8_t  _pin;
 
 
-  int _rnd()
+  void _init()
   {
-    if (_mode == 0 ) return random(256);
-    if (_mode == 1 ) return _hardware();
-    if (_mode == 2 ) return _analog();
-    return 0;
-  }
+    // fractional part of sqrt(2), sqrt(3), sqrt(5), sqrt(7)
+    _pool[0] = 0x6A09E667;
+    _pool[1] = 0xBB67AE85;
+    _pool[2] = 0x3C6EF372;
+    _pool[3] = 0xA54FF53A;
+    _counter[0] = 0;
+    _counter[1] = 0;
+    _inCount = 0;
+    _pending = false;
+    _pos = 16;
+    _mode = DEVRANDOM_MODE_SW;
+    _pin = 0;
+  };
 
 
-  int _hardware()
+  void _absorb(uint8_t data)
   {
-    uint8_t val = 0;
-    for (uint8_t i = 0; i < 8; i++)
+    _in[_inCount++] = data;
+    if (_inCount == 16) _compress();
+  };
+
+
+  // pool = F(block, pool) ^ pool
+  // a partial block is padded with zeros and its length.
+  void _compress()
+  {
+    uint32_t key[4];
+    uint32_t x[4];
+    memset(&_in[_inCount], 0, 16 - _inCount);
+    for (uint8_t i = 0; i < 4; i++)
     {
-      val <<= 1;
-      // TODO register optimized read for speed? ==> Not portable
-      if (digitalRead(_pin)) val++;  
+      key[i] = (uint32_t)_in[i * 4] | ((uint32_t)_in[i * 4 + 1] << 8) |
+               ((uint32_t)_in[i * 4 + 2] << 16) | ((uint32_t)_in[i * 4 + 3] << 24);
+      x[i] = _pool[i];
+    }
+    x[3] ^= _inCount;
+    _threefry(x, key);
+    for (uint8_t i = 0; i < 4; i++) _pool[i] ^= x[i];
+    _inCount = 0;
+    _pending = false;
+  };
+
+
+  void _refill()
+  {
+    if (_mode != DEVRANDOM_MODE_SW)
+    {
+      for (uint8_t i = 0; i < 16; i++) _absorb(_noise());
+    }
+    else if (_pending)
+    {
+      _compress();
     }
-    return val ^ _seed;
-  }
+    uint32_t x[4] = { _counter[0], _counter[1], 0, 0 };
+    if (++_counter[0] == 0) _counter[1]++;
+    _threefry(x, _pool);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+      _out[i * 4]     = x[i];
+      _out[i * 4 + 1] = x[i] >> 8;
+      _out[i * 4 + 2] = x[i] >> 16;
+      _out[i * 4 + 3] = x[i] >> 24;
+    }
+    _pos = 0;
+  };
 
 
-  int _analog()
+  // 8 raw bits from the pin
+  uint8_t _noise()
   {
     uint8_t val = 0;
     for (uint8_t i = 0; i < 8; i++)
     {
       val <<= 1;
-      if (analogRead(_pin) & 1) val++;
+      if (_mode == DEVRANDOM_MODE_HW)
+      {
+        // TODO register optimized read for speed? ==> Not portable
+        if (digitalRead(_pin)) val++;
+      }
+      else
+      {
+        if (analogRead(_pin) & 1) val++;
+      }
     }
-    return val ^ _seed;
-  }
+    return val;
+  };
+
+
+  // a += b, b = rotl(b, r) ^ a,   r is a constant after inlining
+  static inline void _mix(uint32_t & a, uint32_t & b, const uint8_t r)
+  {
+    a += b;
+    b = ((b << r) | (b >> (32 - r))) ^ a;
+  };
+
+
+  // 4 rounds + key injection s
+  static inline void _round4(uint32_t * x, const uint32_t * ks, uint8_t s, const uint8_t * R)
+  {
+    _mix(x[0], x[1], R[0]); _mix(x[2], x[3], R[1]);
+    _mix(x[0], x[3], R[2]); _mix(x[2], x[1], R[3]);
+    _mix(x[0], x[1], R[4]); _mix(x[2], x[3], R[5]);
+    _mix(x[0], x[3], R[6]); _mix(x[2], x[1], R[7]);
+    x[0] += ks[s];
+    x[1] += ks[s + 1];
+    x[2] += ks[s + 2];
+    x[3] += ks[s + 3] + s;
+  };
+
+
+  // Threefry-4x32-20, x = counter in, result out.
+  // fully unrolled so all rotations are constant.
+  static void _threefry(uint32_t x[4], const uint32_t k[4])
+  {
+    static const uint8_t RA[8] = { 10, 26, 11, 21, 13, 27, 23,  5 };
+    static const uint8_t RB[8] = {  6, 20, 17, 11, 25, 10, 18, 20 };
+    uint32_t ks[9];
+    ks[4] = 0x1BD11BDA;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+      ks[i] = k[i];
+      ks[4] ^= k[i];
+      x[i] += k[i];
+    }
+    for (uint8_t i = 5; i < 9; i++) ks[i] = ks[i - 5];
+
+    _round4(x, ks, 1, RA);
+    _round4(x, ks, 2, RB);
+    _round4(x, ks, 3, RA);
+    _round4(x, ks, 4, RB);
+    _round4(x, ks, 5, RA);
+  };
 };
 
-// TODO alternative random nummer generator so all platforms behave same.
 
 // -- END OF FILE --
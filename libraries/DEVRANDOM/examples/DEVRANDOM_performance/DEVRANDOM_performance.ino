@@ -0,0 +1,84 @@
+//
+//    FILE: DEVRANDOM_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: throughput read() vs readBytes() + byte distribution
+//    DATE: 2021-09-23
+//    (c) : MIT
+//
+
+#include "DEVRANDOM.h"
+
+DEVRANDOM dr;
+
+uint8_t  buf[256];
+uint16_t count[256];
+uint32_t start, duration;
+volatile int x;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("DEVRANDOM_LIB_VERSION: ");
+  Serial.println(DEVRANDOM_LIB_VERSION);
+  Serial.println();
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1024; i++) x = random(256);
+  duration = micros() - start;
+  Serial.print("random(256):\t");
+  Serial.println(duration / 1024.0, 2);
+
+  // via the Stream interface, one virtual call per byte.
+  Stream * s = &dr;
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1024; i++) x = s->read();
+  duration = micros() - start;
+  Serial.print("read():\t\t");
+  Serial.println(duration / 1024.0, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 4; i++) dr.readBytes(buf, 256);
+  duration = micros() - start;
+  Serial.print("readBytes():\t");
+  Serial.println(duration / 1024.0, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1024; i++) dr.write(i);
+  x = dr.read();
+  duration = micros() - start;
+  Serial.print("write():\t");
+  Serial.println(duration / 1024.0, 2);
+  Serial.println("(us per byte)\n");
+
+  // chi square 64 KB, df = 255 => should be < 330.5 (p = 0.001)
+  for (int r = 0; r < 256; r++)
+  {
+    dr.readBytes(buf, 256);
+    for (int i = 0; i < 256; i++) count[buf[i]]++;
+  }
+  float chi2 = 0;
+  for (int i = 0; i < 256; i++)
+  {
+    float d = count[i] - 256.0;
+    chi2 += d * d / 256.0;
+  }
+  Serial.print("chi square:\t");
+  Serial.println(chi2, 1);
+
+  Serial.println("\nDone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
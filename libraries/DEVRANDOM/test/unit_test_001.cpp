@@ -85,6 +85,81 @@ unittest(test_generator_mode)
   }
 }
 
+unittest(test_known_output)
+{
+  // same on all platforms, Threefry-4x32-20
+  uint8_t first[16] = { 34, 201, 121, 6, 234, 54, 86, 103, 164, 56, 118, 179, 229, 92, 243, 198 };
+  DEVRANDOM dr;
+  for (int i = 0; i < 16; i++) assertEqual(first[i], dr.read());
+
+  uint8_t hello[8] = { 180, 180, 102, 93, 119, 66, 70, 59 };
+  DEVRANDOM dr2("hello world");
+  for (int i = 0; i < 8; i++) assertEqual(hello[i], dr2.read());
+}
+
+
+unittest(test_readBytes)
+{
+  DEVRANDOM a((uint32_t)42);
+  DEVRANDOM b((uint32_t)42);
+  uint8_t buf[100];
+
+  // unaligned start, spans several blocks
+  assertEqual(a.read(), b.read());
+  assertEqual(a.read(), b.read());
+  assertEqual(100, a.readBytes(buf, 100));
+  for (int i = 0; i < 100; i++) assertEqual(buf[i], b.read());
+  assertEqual(a.peek(), b.peek());
+}
+
+
+unittest(test_reseed)
+{
+  DEVRANDOM a;
+  DEVRANDOM b;
+  a.print("seed");
+  b.print("seed");
+  for (int i = 0; i < 40; i++) assertEqual(a.read(), b.read());
+
+  a.write('x');
+  b.write('y');
+  int same = 0;
+  for (int i = 0; i < 40; i++) if (a.read() == b.read()) same++;
+  assertMore(5, same);
+
+  // bulk write == byte writes
+  DEVRANDOM c;
+  DEVRANDOM d;
+  uint8_t data[20] = "0123456789ABCDEFGHI";
+  c.write(data, 20);
+  for (int i = 0; i < 20; i++) d.write(data[i]);
+  for (int i = 0; i < 40; i++) assertEqual(c.read(), d.read());
+}
+
+
+unittest(test_chi_square)
+{
+  DEVRANDOM dr;
+  uint8_t buf[256];
+  uint32_t count[256];
+  memset(count, 0, sizeof(count));
+  for (int r = 0; r < 256; r++)
+  {
+    dr.readBytes(buf, 256);
+    for (int i = 0; i < 256; i++) count[buf[i]]++;
+  }
+  float chi2 = 0;
+  for (int i = 0; i < 256; i++)
+  {
+    float d = count[i] - 256.0;
+    chi2 += d * d / 256.0;
+  }
+  fprintf(stderr, "chi2: %f\n", chi2);
+  // df = 255, p = 0.001
+  assertMore(330.5, chi2);
+}
+
+
 unittest_main()
 
 // --------
@@ -0,0 +1,425 @@
+//
+//    FILE: DigitalFilter.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-09
+// VERSION: 0.1.0
+// PURPOSE: Arduino library for biquad (IIR), FIR and CIC filters
+//     URL: https://github.com/RobTillaart/DigitalFilter
+//
+//  HISTORY:
+//  0.1.0   2021-09-09  initial version
+
+
+#include "DigitalFilter.h"
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DESIGN
+//
+// https://www.w3.org/TR/audio-eq-cookbook/
+//
+static BiquadCoeff _normalize(float b0, float b1, float b2, float a0, float a1, float a2)
+{
+  BiquadCoeff c;
+  c.b0 = b0 / a0;
+  c.b1 = b1 / a0;
+  c.b2 = b2 / a0;
+  c.a1 = a1 / a0;
+  c.a2 = a2 / a0;
+  return c;
+}
+
+
+BiquadCoeff biquadLowPass(float fs, float f0, float Q)
+{
+  float w0 = 2 * PI * f0 / fs;
+  float cs = cos(w0);
+  float alpha = sin(w0) / (2 * Q);
+  return _normalize((1 - cs) / 2, 1 - cs, (1 - cs) / 2, 1 + alpha, -2 * cs, 1 - alpha);
+}
+
+
+BiquadCoeff biquadHighPass(float fs, float f0, float Q)
+{
+  float w0 = 2 * PI * f0 / fs;
+  float cs = cos(w0);
+  float alpha = sin(w0) / (2 * Q);
+  return _normalize((1 + cs) / 2, -(1 + cs), (1 + cs) / 2, 1 + alpha, -2 * cs, 1 - alpha);
+}
+
+
+BiquadCoeff biquadBandPass(float fs, float f0, float Q)
+{
+  float w0 = 2 * PI * f0 / fs;
+  float cs = cos(w0);
+  float alpha = sin(w0) / (2 * Q);
+  return _normalize(alpha, 0, -alpha, 1 + alpha, -2 * cs, 1 - alpha);
+}
+
+
+BiquadCoeff biquadNotch(float fs, float f0, float Q)
+{
+  float w0 = 2 * PI * f0 / fs;
+  float cs = cos(w0);
+  float alpha = sin(w0) / (2 * Q);
+  return _normalize(1, -2 * cs, 1, 1 + alpha, -2 * cs, 1 - alpha);
+}
+
+
+// |H(e^jw)|
+float biquadMagnitude(const BiquadCoeff & c, float fs, float f)
+{
+  float w = 2 * PI * f / fs;
+  float c1 = cos(w), s1 = sin(w);
+  float c2 = cos(2 * w), s2 = sin(2 * w);
+  float nr = c.b0 + c.b1 * c1 + c.b2 * c2;
+  float ni = -(c.b1 * s1 + c.b2 * s2);
+  float dr = 1 + c.a1 * c1 + c.a2 * c2;
+  float di = -(c.a1 * s1 + c.a2 * s2);
+  return sqrt((nr * nr + ni * ni) / (dr * dr + di * di));
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD
+//
+Biquad::Biquad()
+{
+  BiquadCoeff c = { 1, 0, 0, 0, 0 };   // pass through
+  setCoefficients(c);
+}
+
+
+void Biquad::setCoefficients(const BiquadCoeff & c)
+{
+  _c = c;
+  reset();
+}
+
+
+void Biquad::reset()
+{
+  _z1 = 0;
+  _z2 = 0;
+}
+
+
+float Biquad::process(float x)
+{
+  float y = _c.b0 * x + _z1;
+  _z1 = _c.b1 * x - _c.a1 * y + _z2;
+  _z2 = _c.b2 * x - _c.a2 * y;
+  return y;
+}
+
+
+// state and coefficients in local variables => registers
+void Biquad::process(const float * in, float * out, uint16_t n)
+{
+  float b0 = _c.b0, b1 = _c.b1, b2 = _c.b2;
+  float a1 = _c.a1, a2 = _c.a2;
+  float z1 = _z1, z2 = _z2;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    float x = in[i];
+    float y = b0 * x + z1;
+    z1 = b1 * x - a1 * y + z2;
+    z2 = b2 * x - a2 * y;
+    out[i] = y;
+  }
+  _z1 = z1;
+  _z2 = z2;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD CASCADE
+//
+BiquadCascade::BiquadCascade()
+{
+  _count = 0;
+}
+
+
+bool BiquadCascade::addSection(const BiquadCoeff & c)
+{
+  if (_count >= BIQUAD_MAX_SECTIONS) return false;
+  _section[_count++].setCoefficients(c);
+  return true;
+}
+
+
+void BiquadCascade::reset()
+{
+  for (uint8_t s = 0; s < _count; s++) _section[s].reset();
+}
+
+
+float BiquadCascade::process(float x)
+{
+  for (uint8_t s = 0; s < _count; s++) x = _section[s].process(x);
+  return x;
+}
+
+
+void BiquadCascade::process(const float * in, float * out, uint16_t n)
+{
+  if (_count == 0)
+  {
+    if (in != out) memmove(out, in, n * sizeof(float));
+    return;
+  }
+  _section[0].process(in, out, n);
+  for (uint8_t s = 1; s < _count; s++) _section[s].process(out, out, n);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD Q15
+//
+static bool _toFixed(double f, double scale, int32_t low, int32_t high, int32_t & out)
+{
+  double v = round(f * scale);
+  if ((v < low) || (v > high)) return false;
+  out = v;
+  return true;
+}
+
+
+BiquadQ15::BiquadQ15()
+{
+  _b0 = 16384;   // 1.0 = pass through
+  _b1 = _b2 = _a1 = _a2 = 0;
+  reset();
+}
+
+
+bool BiquadQ15::setCoefficients(const BiquadCoeff & c)
+{
+  int32_t b0, b1, b2, a1, a2;
+  if (!_toFixed(c.b0, 16384, -32768, 32767, b0)) return false;
+  if (!_toFixed(c.b1, 16384, -32768, 32767, b1)) return false;
+  if (!_toFixed(c.b2, 16384, -32768, 32767, b2)) return false;
+  if (!_toFixed(c.a1, 16384, -32768, 32767, a1)) return false;
+  if (!_toFixed(c.a2, 16384, -32768, 32767, a2)) return false;
+  _b0 = b0;
+  _b1 = b1;
+  _b2 = b2;
+  _a1 = a1;
+  _a2 = a2;
+  reset();
+  return true;
+}
+
+
+void BiquadQ15::reset()
+{
+  _x1 = _x2 = _y1 = _y2 = 0;
+}
+
+
+int16_t BiquadQ15::process(int16_t x)
+{
+  // 16x16 => 32 bit products, summed in 64 bit, no overflow possible.
+  int64_t acc = (int32_t)_b0 * x;
+  acc += (int32_t)_b1 * _x1;
+  acc += (int32_t)_b2 * _x2;
+  acc -= (int32_t)_a1 * _y1;
+  acc -= (int32_t)_a2 * _y2;
+  acc >>= 14;
+  if (acc > 32767)  acc = 32767;
+  if (acc < -32768) acc = -32768;
+  _x2 = _x1;
+  _x1 = x;
+  _y2 = _y1;
+  _y1 = acc;
+  return _y1;
+}
+
+
+void BiquadQ15::process(const int16_t * in, int16_t * out, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; i++) out[i] = process(in[i]);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD Q31
+//
+BiquadQ31::BiquadQ31()
+{
+  _b0 = 1073741824L;   // 1.0 = pass through
+  _b1 = _b2 = _a1 = _a2 = 0;
+  reset();
+}
+
+
+bool BiquadQ31::setCoefficients(const BiquadCoeff & c)
+{
+  int32_t b0, b1, b2, a1, a2;
+  if (!_toFixed(c.b0, 1073741824.0, -2147483647L, 2147483647L, b0)) return false;
+  if (!_toFixed(c.b1, 1073741824.0, -2147483647L, 2147483647L, b1)) return false;
+  if (!_toFixed(c.b2, 1073741824.0, -2147483647L, 2147483647L, b2)) return false;
+  if (!_toFixed(c.a1, 1073741824.0, -2147483647L, 2147483647L, a1)) return false;
+  if (!_toFixed(c.a2, 1073741824.0, -2147483647L, 2147483647L, a2)) return false;
+  _b0 = b0;
+  _b1 = b1;
+  _b2 = b2;
+  _a1 = a1;
+  _a2 = a2;
+  reset();
+  return true;
+}
+
+
+void BiquadQ31::reset()
+{
+  _x1 = _x2 = _y1 = _y2 = 0;
+}
+
+
+int32_t BiquadQ31::process(int32_t x)
+{
+  // Q2.30 x Q31 = Q61, >> 2 leaves room to add 5 terms in 64 bit.
+  int64_t acc = ((int64_t)_b0 * x) >> 2;
+  acc += ((int64_t)_b1 * _x1) >> 2;
+  acc += ((int64_t)_b2 * _x2) >> 2;
+  acc -= ((int64_t)_a1 * _y1) >> 2;
+  acc -= ((int64_t)_a2 * _y2) >> 2;
+  acc >>= 28;
+  if (acc > 2147483647LL)  acc = 2147483647LL;
+  if (acc < -2147483648LL) acc = -2147483648LL;
+  _x2 = _x1;
+  _x1 = x;
+  _y2 = _y1;
+  _y1 = acc;
+  return _y1;
+}
+
+
+void BiquadQ31::process(const int32_t * in, int32_t * out, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; i++) out[i] = process(in[i]);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// FIR
+//
+FIRFilter::FIRFilter(const float * coefficients, uint16_t taps)
+{
+  _coef  = coefficients;
+  _taps  = taps;
+  _buffer = (float *) malloc(_taps * sizeof(float));
+  if (_buffer == NULL) _taps = 0;
+  reset();
+}
+
+
+FIRFilter::~FIRFilter()
+{
+  free(_buffer);
+}
+
+
+void FIRFilter::reset()
+{
+  for (uint16_t i = 0; i < _taps; i++) _buffer[i] = 0;
+  _index = 0;
+}
+
+
+// y = c[0] x[n] + c[1] x[n-1] + ...
+float FIRFilter::process(float x)
+{
+  if (_taps == 0) return x;
+  _buffer[_index] = x;
+  float y = 0;
+  uint16_t j = _index;
+  for (uint16_t i = 0; i < _taps; i++)
+  {
+    y += _coef[i] * _buffer[j];
+    j = (j == 0) ? _taps - 1 : j - 1;
+  }
+  _index++;
+  if (_index == _taps) _index = 0;
+  return y;
+}
+
+
+void FIRFilter::process(const float * in, float * out, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; i++) out[i] = process(in[i]);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// CIC
+//
+CICDecimator::CICDecimator(uint8_t order, uint16_t decimation)
+{
+  if (order < 1) order = 1;
+  if (order > CIC_MAX_ORDER) order = CIC_MAX_ORDER;
+  if (decimation < 1) decimation = 1;
+  _order = order;
+  _decimation = decimation;
+  _gain = pow(decimation, order);
+  reset();
+}
+
+
+void CICDecimator::reset()
+{
+  for (uint8_t i = 0; i < CIC_MAX_ORDER; i++)
+  {
+    _integrator[i] = 0;
+    _comb[i] = 0;
+  }
+  _count = 0;
+  _out = 0;
+}
+
+
+bool CICDecimator::add(int32_t x)
+{
+  // integrators at input rate
+  uint32_t v = x;
+  for (uint8_t i = 0; i < _order; i++)
+  {
+    _integrator[i] += v;
+    v = _integrator[i];
+  }
+  if (++_count < _decimation) return false;
+  _count = 0;
+
+  // combs at output rate
+  for (uint8_t i = 0; i < _order; i++)
+  {
+    uint32_t t = v;
+    v -= _comb[i];
+    _comb[i] = t;
+  }
+  _out = (int32_t)v;
+  return true;
+}
+
+
+uint16_t CICDecimator::process(const int16_t * in, int32_t * out, uint16_t n)
+{
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    if (add(in[i])) out[count++] = _out;
+  }
+  return count;
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,193 @@
+#pragma once
+//
+//    FILE: DigitalFilter.h
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-09
+// VERSION: 0.1.0
+// PURPOSE: Arduino library for biquad (IIR), FIR and CIC filters
+//     URL: https://github.com/RobTillaart/DigitalFilter
+//
+
+
+#include "Arduino.h"
+
+
+#define DIGITALFILTER_LIB_VERSION         (F("0.1.0"))
+
+#ifndef BIQUAD_MAX_SECTIONS
+#define BIQUAD_MAX_SECTIONS               4
+#endif
+
+#define CIC_MAX_ORDER                     4
+
+
+// y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+// a0 is normalized to 1.
+struct BiquadCoeff
+{
+  float b0, b1, b2, a1, a2;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DESIGN  - RBJ audio EQ cookbook
+//
+// fs = sample frequency, f0 = corner / center frequency, both in Hz.
+BiquadCoeff biquadLowPass(float fs, float f0, float Q = 0.70710678);
+BiquadCoeff biquadHighPass(float fs, float f0, float Q = 0.70710678);
+// 0 dB gain at f0
+BiquadCoeff biquadBandPass(float fs, float f0, float Q = 1.0);
+BiquadCoeff biquadNotch(float fs, float f0, float Q = 10.0);
+// gain of the filter at frequency f
+float       biquadMagnitude(const BiquadCoeff & c, float fs, float f);
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD - float, transposed direct form II
+//
+class Biquad
+{
+public:
+  Biquad();
+
+  void        setCoefficients(const BiquadCoeff & c);
+  BiquadCoeff getCoefficients()  { return _c; };
+  void        reset();
+
+  float       process(float x);
+  void        process(const float * in, float * out, uint16_t n);
+
+private:
+  BiquadCoeff _c;
+  float       _z1;
+  float       _z2;
+};
+
+
+class BiquadCascade
+{
+public:
+  BiquadCascade();
+
+  // returns false if BIQUAD_MAX_SECTIONS is reached.
+  bool        addSection(const BiquadCoeff & c);
+  uint8_t     sections()  { return _count; };
+  void        clear()     { _count = 0; };
+  void        reset();
+
+  float       process(float x);
+  // in == out allowed, processes the block section by section.
+  void        process(const float * in, float * out, uint16_t n);
+
+private:
+  Biquad      _section[BIQUAD_MAX_SECTIONS];
+  uint8_t     _count;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIQUAD - fixed point, direct form I
+//
+// data Q15, coefficients Q2.14 (range -2 .. 2)
+// 64 bit accumulator, saturating output.
+class BiquadQ15
+{
+public:
+  BiquadQ15();
+
+  // returns false if a coefficient is out of range.
+  bool        setCoefficients(const BiquadCoeff & c);
+  void        reset();
+
+  int16_t     process(int16_t x);
+  void        process(const int16_t * in, int16_t * out, uint16_t n);
+
+private:
+  int16_t     _b0, _b1, _b2, _a1, _a2;
+  int16_t     _x1, _x2, _y1, _y2;
+};
+
+
+// data Q31, coefficients Q2.30 (range -2 .. 2)
+class BiquadQ31
+{
+public:
+  BiquadQ31();
+
+  // returns false if a coefficient is out of range.
+  bool        setCoefficients(const BiquadCoeff & c);
+  void        reset();
+
+  int32_t     process(int32_t x);
+  void        process(const int32_t * in, int32_t * out, uint16_t n);
+
+private:
+  int32_t     _b0, _b1, _b2, _a1, _a2;
+  int32_t     _x1, _x2, _y1, _y2;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// FIR - float, coefficients are not copied.
+//
+class FIRFilter
+{
+public:
+  FIRFilter(const float * coefficients, uint16_t taps);
+  ~FIRFilter();
+
+  // returns 0 if allocation failed.
+  uint16_t    taps()  { return _taps; };
+  void        reset();
+
+  float       process(float x);
+  void        process(const float * in, float * out, uint16_t n);
+
+private:
+  const float * _coef;
+  float *     _buffer;
+  uint16_t    _taps;
+  uint16_t    _index;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// CIC - decimator, cascaded integrator comb = moving average ^ order
+//
+// gain = decimation ^ order, the input bits + order * log2(decimation)
+// must fit in 32 bits. e.g. 16 bit ADC, order 3 => decimation <= 32.
+class CICDecimator
+{
+public:
+  CICDecimator(uint8_t order = 3, uint16_t decimation = 16);
+
+  void        reset();
+  // returns true if a new output is available.
+  bool        add(int32_t x);
+  int32_t     read()        { return _out; };
+  float       readScaled()  { return _out / _gain; };
+  float       gain()        { return _gain; };
+  uint8_t     order()       { return _order; };
+  uint16_t    decimation()  { return _decimation; };
+
+  // returns the number of outputs written to out.
+  uint16_t    process(const int16_t * in, int32_t * out, uint16_t n);
+
+private:
+  uint8_t     _order;
+  uint16_t    _decimation;
+  uint16_t    _count;
+  float       _gain;
+  int32_t     _out;
+  // unsigned for well defined wrap around
+  uint32_t    _integrator[CIC_MAX_ORDER];
+  uint32_t    _comb[CIC_MAX_ORDER];
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,114 @@
+//
+//    FILE: DigitalFilter_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: samples per second of the filters compared to chained RunningAverage
+//    DATE: 2021-09-09
+//     URL: https://github.com/RobTillaart/DigitalFilter
+//
+// needs https://github.com/RobTillaart/RunningAverage
+
+
+#include "DigitalFilter.h"
+#include "RunningAverage.h"
+
+
+#define SAMPLES   256
+
+float   fin[SAMPLES], fout[SAMPLES];
+int16_t qin[SAMPLES], qout[SAMPLES];
+int32_t cicOut[SAMPLES];
+
+RunningAverage RA1(8);
+RunningAverage RA2(8);
+
+Biquad        lowpass;
+BiquadCascade notch;
+BiquadQ15     lowpassQ15;
+CICDecimator  cic(2, 8);
+
+uint32_t start, stop;
+volatile float x;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("DIGITALFILTER_LIB_VERSION: ");
+  Serial.println(DIGITALFILTER_LIB_VERSION);
+  Serial.println();
+
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    fin[i] = 0.5 * sin(2 * PI * 50 * i / 1000.0) + random(100) * 0.001;
+    qin[i] = fin[i] * 32767;
+  }
+
+  lowpass.setCoefficients(biquadLowPass(1000, 20));
+  notch.addSection(biquadNotch(1000, 50));    //  EU mains
+  notch.addSection(biquadNotch(1000, 60));    //  US mains
+  lowpassQ15.setCoefficients(biquadLowPass(1000, 20));
+
+  Serial.println("FILTER\t\tUS\tSAMPLES/SEC");
+
+  // reference, 2 RunningAverage chained ~ 2nd order moving average.
+  start = micros();
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    RA1.addValue(fin[i]);
+    RA2.addValue(RA1.getAverage());
+    x = RA2.getAverage();
+  }
+  stop = micros();
+  report("RA x 2\t", stop - start);
+
+  start = micros();
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    x = lowpass.process(fin[i]);
+  }
+  stop = micros();
+  report("Biquad\t", stop - start);
+
+  start = micros();
+  lowpass.process(fin, fout, SAMPLES);
+  stop = micros();
+  report("Biquad block", stop - start);
+
+  start = micros();
+  notch.process(fin, fout, SAMPLES);
+  stop = micros();
+  report("Cascade x 2", stop - start);
+
+  start = micros();
+  lowpassQ15.process(qin, qout, SAMPLES);
+  stop = micros();
+  report("BiquadQ15\t", stop - start);
+
+  start = micros();
+  cic.process(qin, cicOut, SAMPLES);
+  stop = micros();
+  report("CIC 2 x 8\t", stop - start);
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+void report(const char * name, uint32_t duration)
+{
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(duration);
+  Serial.print("\t");
+  Serial.println(SAMPLES * 1e6 / duration, 0);
+  delay(100);
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,229 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-09
+// PURPOSE: unit tests for the DigitalFilter library
+//          https://github.com/RobTillaart/DigitalFilter
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+
+#include <ArduinoUnitTests.h>
+
+#include "Arduino.h"
+#include "DigitalFilter.h"
+
+
+// peak of the output of a sine of frequency f, after settling.
+float peak(Biquad & bq, float fs, float f)
+{
+  float mx = 0;
+  bq.reset();
+  for (int i = 0; i < 4000; i++)
+  {
+    float y = bq.process(sin(2 * PI * f * i / fs));
+    if ((i > 3000) && (fabs(y) > mx)) mx = fabs(y);
+  }
+  return mx;
+}
+
+
+unittest_setup()
+{
+}
+
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_design)
+{
+  fprintf(stderr, "DIGITALFILTER_LIB_VERSION: %s\n", (char *) DIGITALFILTER_LIB_VERSION);
+
+  BiquadCoeff lp = biquadLowPass(10000, 1000);
+  assertEqualFloat(1.0,   biquadMagnitude(lp, 10000, 0),    0.001);
+  assertEqualFloat(0.707, biquadMagnitude(lp, 10000, 1000), 0.001);
+  assertMore(0.05, biquadMagnitude(lp, 10000, 4000));
+
+  BiquadCoeff hp = biquadHighPass(10000, 1000);
+  assertEqualFloat(0.0,   biquadMagnitude(hp, 10000, 0),    0.001);
+  assertEqualFloat(0.707, biquadMagnitude(hp, 10000, 1000), 0.001);
+
+  BiquadCoeff bp = biquadBandPass(10000, 1000, 2);
+  assertEqualFloat(1.0, biquadMagnitude(bp, 10000, 1000), 0.001);
+  assertMore(0.2, biquadMagnitude(bp, 10000, 100));
+
+  BiquadCoeff notch = biquadNotch(1000, 50);
+  assertEqualFloat(0.0, biquadMagnitude(notch, 1000, 50), 0.001);
+  assertEqualFloat(1.0, biquadMagnitude(notch, 1000, 0),  0.001);
+  assertMore(biquadMagnitude(notch, 1000, 100), 0.99);
+}
+
+
+unittest(test_biquad)
+{
+  Biquad bq;
+  // pass through
+  assertEqualFloat(0.5, bq.process(0.5), 0.0001);
+
+  // 50 Hz mains notch, 1000 Hz sample rate
+  bq.setCoefficients(biquadNotch(1000, 50, 5));
+  assertMore(0.01, peak(bq, 1000, 50));
+  assertMore(peak(bq, 1000, 200), 0.95);
+
+  // block equals single
+  float in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (i % 7) - 3;
+  bq.reset();
+  bq.process(in, out, 100);
+  Biquad bq2;
+  bq2.setCoefficients(biquadNotch(1000, 50, 5));
+  for (int i = 0; i < 100; i++)
+  {
+    assertEqualFloat(bq2.process(in[i]), out[i], 0.0001);
+  }
+}
+
+
+unittest(test_cascade)
+{
+  BiquadCascade cascade;
+  assertEqual(0, cascade.sections());
+  for (int i = 0; i < BIQUAD_MAX_SECTIONS; i++)
+  {
+    assertTrue(cascade.addSection(biquadLowPass(10000, 1000)));
+  }
+  assertFalse(cascade.addSection(biquadLowPass(10000, 1000)));
+  cascade.clear();
+  cascade.addSection(biquadLowPass(10000, 1000));
+  cascade.addSection(biquadLowPass(10000, 1000));
+  assertEqual(2, cascade.sections());
+
+  // DC gain 1
+  float y = 0;
+  for (int i = 0; i < 200; i++) y = cascade.process(1.0);
+  assertEqualFloat(1.0, y, 0.001);
+
+  // in place block processing equals single
+  float buf[64];
+  for (int i = 0; i < 64; i++) buf[i] = (i & 1) ? 1 : -1;
+  cascade.reset();
+  cascade.process(buf, buf, 64);
+  BiquadCascade c2;
+  c2.addSection(biquadLowPass(10000, 1000));
+  c2.addSection(biquadLowPass(10000, 1000));
+  for (int i = 0; i < 64; i++)
+  {
+    assertEqualFloat(c2.process((i & 1) ? 1 : -1), buf[i], 0.0001);
+  }
+}
+
+
+unittest(test_fixed_point)
+{
+  BiquadCoeff lp = biquadLowPass(1000, 50);
+  Biquad bq;
+  BiquadQ15 q15;
+  BiquadQ31 q31;
+  bq.setCoefficients(lp);
+  assertTrue(q15.setCoefficients(lp));
+  assertTrue(q31.setCoefficients(lp));
+
+  float maxErr15 = 0, maxErr31 = 0;
+  for (int i = 0; i < 1000; i++)
+  {
+    float x = 0.4 * sin(2 * PI * 30 * i / 1000.0) + 0.4 * sin(2 * PI * 300 * i / 1000.0);
+    float y = bq.process(x);
+    float y15 = q15.process(round(x * 32767)) / 32768.0;
+    float y31 = q31.process(round(x * 2147483647.0)) / 2147483648.0;
+    if (fabs(y - y15) > maxErr15) maxErr15 = fabs(y - y15);
+    if (fabs(y - y31) > maxErr31) maxErr31 = fabs(y - y31);
+  }
+  fprintf(stderr, "max error Q15: %f   Q31: %f\n", maxErr15, maxErr31);
+  assertMore(0.005, maxErr15);
+  assertMore(0.0001, maxErr31);
+
+  // saturation
+  q15.setCoefficients(biquadLowPass(1000, 50));
+  int16_t y = 0;
+  for (int i = 0; i < 200; i++) y = q15.process(32767);
+  assertMoreOrEqual(32767, y);
+  assertMore(y, 32700);
+
+  // out of range coefficient
+  BiquadCoeff bad = { 3, 0, 0, 0, 0 };
+  assertFalse(q15.setCoefficients(bad));
+  assertFalse(q31.setCoefficients(bad));
+}
+
+
+unittest(test_fir)
+{
+  float coef[4] = { 0.25, 0.25, 0.25, 0.25 };
+  FIRFilter fir(coef, 4);
+  assertEqual(4, fir.taps());
+  assertEqualFloat(0.25, fir.process(1), 0.0001);
+  assertEqualFloat(0.50, fir.process(1), 0.0001);
+  assertEqualFloat(0.75, fir.process(1), 0.0001);
+  assertEqualFloat(1.00, fir.process(1), 0.0001);
+  assertEqualFloat(1.00, fir.process(1), 0.0001);
+  assertEqualFloat(0.75, fir.process(0), 0.0001);
+}
+
+
+unittest(test_cic)
+{
+  CICDecimator cic(1, 4);
+  assertEqual(1, cic.order());
+  assertEqual(4, cic.decimation());
+  assertEqualFloat(4, cic.gain(), 0.001);
+
+  // order 1 = sum of blocks of 4
+  assertFalse(cic.add(1));
+  assertFalse(cic.add(2));
+  assertFalse(cic.add(3));
+  assertTrue(cic.add(4));
+  assertEqual(10, cic.read());
+  for (int i = 0; i < 3; i++) cic.add(10);
+  assertTrue(cic.add(10));
+  assertEqual(40, cic.read());
+  assertEqualFloat(10, cic.readScaled(), 0.001);
+
+  // order 3, DC gain 16^3, 16 bit input, wrap around is OK.
+  CICDecimator cic3(3, 16);
+  int16_t in[256];
+  int32_t out[16];
+  for (int i = 0; i < 256; i++) in[i] = 30000;
+  assertEqual(16, cic3.process(in, out, 256));
+  assertEqual(30000L * 4096, out[15]);
+  assertEqualFloat(30000, cic3.readScaled(), 0.01);
+}
+
+
+unittest_main()
+
+// --------
@@ -1,7 +1,7 @@
 //
 //    FILE: FRAM.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.1
+// VERSION: 0.3.2
 //    DATE: 2018-01-24
 // PURPOSE: Arduino library for I2C FRAM
 //     URL: https://github.com/RobTillaart/FRAM_I2C
@@ -15,6 +15,7 @@
 //  0.2.3   2021-01-ii  fix getMetaData (kudos to PraxisSoft
 //  0.3.0   2021-01-13  fix #2 ESP32 + WireN support
 //  0.3.1   2021-02-05  fix #7 typo in .cpp
+//  0.3.2   2021-09-17  FRAM_I2C_BUFFERSIZE bursts in read() / write(), add FRAMLogger
 
 
 #include "FRAM.h"
@@ -106,7 +107,7 @@ void FRAM::write32(uint16_t memaddr, uint32_t value)
 
 void FRAM::write(uint16_t memaddr, uint8_t * obj, uint16_t size)
 {
-  const int blocksize = 24;
+  const int blocksize = FRAM_I2C_BUFFERSIZE - 2;
   uint8_t * p = obj;
   while (size >= blocksize)
   {
@@ -149,7 +150,7 @@ uint32_t FRAM::read32(uint16_t memaddr)
 
 void FRAM::read(uint16_t memaddr, uint8_t * obj, uint16_t size)
 {
-  const uint8_t blocksize = 24;
+  const uint8_t blocksize = FRAM_I2C_BUFFERSIZE;
   uint8_t * p = obj;
   while (size >= blocksize)
   {
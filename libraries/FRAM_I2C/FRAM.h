@@ -2,7 +2,7 @@
 //
 //    FILE: FRAM.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.1
+// VERSION: 0.3.2
 //    DATE: 2018-01-24
 // PURPOSE: Arduino library for I2C FRAM
 //     URL: https://github.com/RobTillaart/FRAM_I2C
@@ -13,7 +13,7 @@
 #include "Wire.h"
 
 
-#define FRAM_LIB_VERSION              (F("0.3.1"))
+#define FRAM_LIB_VERSION              (F("0.3.2"))
 
 
 #define FRAM_OK                       0
@@ -22,6 +22,17 @@
 #define FRAM_ERROR_CONNECT            -12
 
 
+// read() and write() use bursts as large as the Wire buffer allows,
+// a write burst includes 2 address bytes.
+#ifndef FRAM_I2C_BUFFERSIZE
+#if defined(ESP32) || defined(ESP8266)
+#define FRAM_I2C_BUFFERSIZE           128
+#else
+#define FRAM_I2C_BUFFERSIZE           32     // AVR, STM
+#endif
+#endif
+
+
 class FRAM
 {
 public:
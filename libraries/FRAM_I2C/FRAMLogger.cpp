@@ -0,0 +1,315 @@
+//
+//    FILE: FRAMLogger.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.3.2
+//    DATE: 2021-09-17
+// PURPOSE: Arduino library for I2C FRAM - persistent record ring buffer
+//     URL: https://github.com/RobTillaart/FRAM_I2C
+//
+//  HISTORY: see FRAM.cpp
+
+
+#include "FRAMLogger.h"
+
+
+// CRC16 CCITT, bitwise as it is only done per record.
+static uint16_t _crc16(uint16_t crc, const uint8_t * data, uint16_t length)
+{
+  while (length--)
+  {
+    crc ^= ((uint16_t) *data++) << 8;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      if (crc & 0x8000) crc = (crc << 1) ^ 0x1021;
+      else crc <<= 1;
+    }
+  }
+  return crc;
+}
+
+
+// little endian, independent of the platform
+static void _put16(uint8_t * p, uint16_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+}
+
+
+static void _put32(uint8_t * p, uint32_t v)
+{
+  _put16(p, v);
+  _put16(p + 2, v >> 16);
+}
+
+
+static uint16_t _get16(const uint8_t * p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+
+static uint32_t _get32(const uint8_t * p)
+{
+  return _get16(p) | ((uint32_t)_get16(p + 2) << 16);
+}
+
+
+/////////////////////////////////////////////////////
+//
+// PUBLIC
+//
+FRAMLogger::FRAMLogger()
+{
+  _fram       = NULL;
+  _dataSize   = 0;
+  _overwrite  = true;
+  _generation = 0;
+  _nextSeq    = 0;
+  _head = _tail = _count = _wrap = 0;
+  rewind();
+}
+
+
+int FRAMLogger::begin(FRAM * fram, uint16_t memaddr, uint16_t size)
+{
+  if (size < 2 * FRAM_LOGGER_META_SIZE + FRAM_LOGGER_HEADER_SIZE + 1) return FRAM_LOGGER_ERR_SIZE;
+  _fram     = fram;
+  _memaddr  = memaddr;
+  _dataSize = size - 2 * FRAM_LOGGER_META_SIZE;
+
+  // take the newest valid slot.
+  uint32_t gen0 = 0;
+  bool valid0 = _load(0);
+  if (valid0) gen0 = _generation;
+  bool valid1 = _load(1);
+  if (valid1)
+  {
+    if (valid0 && ((int32_t)(_generation - gen0) < 0)) valid1 = false;
+  }
+  if (!valid1)
+  {
+    if (!valid0)
+    {
+      _generation = 0;
+      format();
+      return FRAM_LOGGER_NEW;
+    }
+    _load(0);
+  }
+  rewind();
+  return FRAM_LOGGER_OK;
+}
+
+
+void FRAMLogger::format()
+{
+  _nextSeq = 0;
+  _head  = 0;
+  _tail  = 0;
+  _count = 0;
+  _wrap  = _dataSize;
+  // both slots, so an old slot can not win.
+  _commit();
+  _commit();
+  rewind();
+}
+
+
+int FRAMLogger::append(const void * data, uint8_t length)
+{
+  uint16_t n = FRAM_LOGGER_HEADER_SIZE + length;
+  if (n > _dataSize) return FRAM_LOGGER_ERR_SIZE;
+
+  uint16_t head = _head;
+  uint16_t wrap = _wrap;
+  bool evicted = false;
+  while (true)
+  {
+    if (_count == 0)
+    {
+      _head = _tail = 0;
+      _wrap = _dataSize;
+      break;
+    }
+    if (!_wrapped())
+    {
+      if (_head + n <= _dataSize) break;
+      _wrap = _head;
+      _head = 0;
+      continue;
+    }
+    if (_head + n <= _tail) break;
+    if (!_overwrite)
+    {
+      _head = head;
+      _wrap = wrap;
+      return FRAM_LOGGER_FULL;
+    }
+    _evict();
+    evicted = true;
+  }
+  // free the space before it is overwritten.
+  if (evicted) _commit();
+
+  uint8_t hdr[FRAM_LOGGER_HEADER_SIZE];
+  hdr[0] = length;
+  _put32(hdr + 1, _nextSeq);
+  uint16_t crc = _crc16(0xFFFF, hdr, 5);
+  crc = _crc16(crc, (const uint8_t *)data, length);
+  _put16(hdr + 5, crc);
+
+  _fram->write(_address(_head + FRAM_LOGGER_HEADER_SIZE), (uint8_t *)data, length);
+  _fram->write(_address(_head), hdr, FRAM_LOGGER_HEADER_SIZE);
+  _head += n;
+  _count++;
+  _nextSeq++;
+  _commit();
+  return FRAM_LOGGER_OK;
+}
+
+
+uint16_t FRAMLogger::remove(uint16_t n)
+{
+  uint16_t removed = 0;
+  while ((removed < n) && (_count > 0))
+  {
+    _evict();
+    removed++;
+  }
+  if (removed > 0) _commit();
+  return removed;
+}
+
+
+uint16_t FRAMLogger::used()
+{
+  if (_count == 0) return 0;
+  if (_wrapped()) return (_wrap - _tail) + _head;
+  return _head - _tail;
+}
+
+
+void FRAMLogger::rewind()
+{
+  _readPos  = _tail;
+  _readLeft = _count;
+  _readSeq  = _nextSeq - _count;
+}
+
+
+int FRAMLogger::readNext(void * data, uint8_t maxLength, uint32_t * seq)
+{
+  if (_readLeft == 0) return 0;
+  if (_readPos >= _wrap) _readPos = 0;
+
+  uint8_t hdr[FRAM_LOGGER_HEADER_SIZE];
+  _fram->read(_address(_readPos), hdr, FRAM_LOGGER_HEADER_SIZE);
+  uint8_t length = hdr[0];
+  if (length > maxLength) return FRAM_LOGGER_ERR_SIZE;
+  _fram->read(_address(_readPos + FRAM_LOGGER_HEADER_SIZE), (uint8_t *)data, length);
+
+  uint16_t crc = _crc16(0xFFFF, hdr, 5);
+  crc = _crc16(crc, (const uint8_t *)data, length);
+  if ((crc != _get16(hdr + 5)) || (_get32(hdr + 1) != _readSeq)) return FRAM_LOGGER_ERR_CRC;
+
+  if (seq != NULL) *seq = _readSeq;
+  _readPos += FRAM_LOGGER_HEADER_SIZE + length;
+  _readSeq++;
+  _readLeft--;
+  return length;
+}
+
+
+uint32_t FRAMLogger::exportRaw(Print & out)
+{
+  if (_count == 0) return 0;
+  if (_wrapped())
+  {
+    uint32_t bytes = _export(out, _tail, _wrap);
+    return bytes + _export(out, 0, _head);
+  }
+  return _export(out, _tail, _head);
+}
+
+
+///////////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+void FRAMLogger::_evict()
+{
+  uint8_t length = _fram->read8(_address(_tail));
+  _tail += FRAM_LOGGER_HEADER_SIZE + length;
+  _count--;
+  if (_tail >= _wrap)
+  {
+    _tail = 0;
+    _wrap = _dataSize;
+  }
+  if (_count == 0)
+  {
+    _head = _tail = 0;
+    _wrap = _dataSize;
+  }
+}
+
+
+void FRAMLogger::_commit()
+{
+  _generation++;
+  uint8_t meta[FRAM_LOGGER_META_SIZE];
+  _put32(meta + 0, _generation);
+  _put32(meta + 4, _nextSeq);
+  _put16(meta + 8, _head);
+  _put16(meta + 10, _tail);
+  _put16(meta + 12, _count);
+  _put16(meta + 14, _wrap);
+  // the size is part of the crc, a different size gives a new log.
+  uint16_t crc = _crc16(_dataSize, meta, FRAM_LOGGER_META_SIZE - 2);
+  _put16(meta + 16, crc);
+  uint16_t addr = _memaddr + (_generation & 1) * FRAM_LOGGER_META_SIZE;
+  _fram->write(addr, meta, FRAM_LOGGER_META_SIZE);
+}
+
+
+bool FRAMLogger::_load(uint8_t slot)
+{
+  uint8_t meta[FRAM_LOGGER_META_SIZE];
+  _fram->read(_memaddr + slot * FRAM_LOGGER_META_SIZE, meta, FRAM_LOGGER_META_SIZE);
+  uint16_t crc = _crc16(_dataSize, meta, FRAM_LOGGER_META_SIZE - 2);
+  if (crc != _get16(meta + 16)) return false;
+
+  uint16_t head  = _get16(meta + 8);
+  uint16_t tail  = _get16(meta + 10);
+  uint16_t wrap  = _get16(meta + 14);
+  if ((head > _dataSize) || (tail > _dataSize) || (wrap > _dataSize)) return false;
+
+  _generation = _get32(meta + 0);
+  _nextSeq    = _get32(meta + 4);
+  _head  = head;
+  _tail  = tail;
+  _count = _get16(meta + 12);
+  _wrap  = wrap;
+  return true;
+}
+
+
+uint32_t FRAMLogger::_export(Print & out, uint16_t from, uint16_t to)
+{
+  uint8_t buffer[FRAM_I2C_BUFFERSIZE];
+  uint32_t bytes = 0;
+  while (from < to)
+  {
+    uint16_t n = to - from;
+    if (n > FRAM_I2C_BUFFERSIZE) n = FRAM_I2C_BUFFERSIZE;
+    _fram->read(_address(from), buffer, n);
+    out.write(buffer, n);
+    from  += n;
+    bytes += n;
+  }
+  return bytes;
+}
+
+
+// -- END OF FILE --
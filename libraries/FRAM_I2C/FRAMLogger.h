@@ -0,0 +1,105 @@
+#pragma once
+//
+//    FILE: FRAMLogger.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.3.2
+//    DATE: 2021-09-17
+// PURPOSE: Arduino library for I2C FRAM - persistent record ring buffer
+//     URL: https://github.com/RobTillaart/FRAM_I2C
+//
+
+
+#include "FRAM.h"
+
+
+#define FRAM_LOGGER_OK                0
+#define FRAM_LOGGER_NEW               1      // begin() found no log and formatted
+#define FRAM_LOGGER_ERR_SIZE          -20
+#define FRAM_LOGGER_ERR_CRC           -21
+#define FRAM_LOGGER_FULL              -22
+
+// record = length (1) + sequence (4) + crc16 (2) + payload
+#define FRAM_LOGGER_HEADER_SIZE       7
+// meta slot = generation (4) + next sequence (4) + head, tail, count, wrap (2 each) + crc16 (2)
+#define FRAM_LOGGER_META_SIZE         18
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// FRAMLOGGER - records of 1..255 bytes in a circular log
+//
+// memory layout from memaddr:  meta slot 0 | meta slot 1 | records ...
+//
+// the records are written first, then the meta data is committed
+// alternating to the two slots with an increasing generation.
+// a power loss during a commit leaves the other slot valid,
+// begin() takes the valid slot with the highest generation.
+// if the oldest records must be overwritten that is committed
+// before their space is reused.
+//
+class FRAMLogger
+{
+public:
+  FRAMLogger();
+
+  // uses size bytes of the FRAM from memaddr.
+  // returns FRAM_LOGGER_OK if an existing log is restored,
+  // FRAM_LOGGER_NEW if a new log is formatted or FRAM_LOGGER_ERR_SIZE.
+  int      begin(FRAM * fram, uint16_t memaddr, uint16_t size);
+  // erases the log, the records are not overwritten.
+  void     format();
+
+  // full log: overwrite (default) the oldest records or return FRAM_LOGGER_FULL
+  void     setOverwrite(bool overwrite)  { _overwrite = overwrite; };
+  bool     getOverwrite()                { return _overwrite; };
+
+  // returns FRAM_LOGGER_OK, FRAM_LOGGER_FULL or FRAM_LOGGER_ERR_SIZE
+  int      append(const void * data, uint8_t length);
+  // removes the oldest n records, e.g. after an export.
+  uint16_t remove(uint16_t n = 1);
+
+  uint16_t count()       { return _count; };
+  // sequence number of the oldest record and of the next append.
+  uint32_t firstSeq()    { return _nextSeq - _count; };
+  uint32_t nextSeq()     { return _nextSeq; };
+  uint16_t size()        { return _dataSize; };
+  // bytes used by the records including their headers.
+  uint16_t used();
+
+  // READ - sequential from the oldest record, append() or remove() invalidates.
+  void     rewind();
+  // returns the length, 0 after the last record, FRAM_LOGGER_ERR_SIZE if
+  // maxLength is too small or FRAM_LOGGER_ERR_CRC.
+  int      readNext(void * data, uint8_t maxLength, uint32_t * seq = NULL);
+
+  // EXPORT - all records in FRAM_I2C_BUFFERSIZE bursts, as stored incl. headers.
+  // returns the number of bytes written.
+  uint32_t exportRaw(Print & out);
+
+private:
+  bool     _wrapped()    { return (_count > 0) && (_head <= _tail); };
+  void     _evict();
+  void     _commit();
+  bool     _load(uint8_t slot);
+  uint32_t _export(Print & out, uint16_t from, uint16_t to);
+  uint16_t _address(uint16_t offset)  { return _memaddr + 2 * FRAM_LOGGER_META_SIZE + offset; };
+
+  FRAM *   _fram;
+  uint16_t _memaddr;
+  uint16_t _dataSize;
+  bool     _overwrite;
+
+  uint32_t _generation;
+  uint32_t _nextSeq;
+  uint16_t _head;        // offset of the next record
+  uint16_t _tail;        // offset of the oldest record
+  uint16_t _count;
+  uint16_t _wrap;        // end of the records before the wrap
+
+  uint16_t _readPos;
+  uint16_t _readLeft;
+  uint32_t _readSeq;
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,114 @@
+//
+//    FILE: FRAMLogger_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: append latency and export speed of the FRAMLogger
+//     URL: https://github.com/RobTillaart/FRAM_I2C
+//
+
+
+#include "FRAM.h"
+#include "FRAMLogger.h"
+
+
+// counts the bytes, so only the FRAM is measured.
+class NullPrint : public Print
+{
+public:
+  size_t write(uint8_t)                   { return 1; };
+  size_t write(const uint8_t *, size_t n) { return n; };
+};
+
+
+FRAM       fram;
+FRAMLogger logger;
+NullPrint  nullPrint;
+
+uint32_t start, stop;
+
+struct
+{
+  uint32_t time;
+  float    temperature;
+  float    humidity;
+  uint32_t counter;
+} record;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("FRAM_LIB_VERSION: ");
+  Serial.println(FRAM_LIB_VERSION);
+  Serial.println();
+
+  Wire.begin();
+  int rv = fram.begin(0x50);
+  if (rv != 0)
+  {
+    Serial.println(rv);
+    return;
+  }
+
+  // 8 KB at address 0
+  rv = logger.begin(&fram, 0, 8192);
+  Serial.print("begin:\t");
+  Serial.println(rv == FRAM_LOGGER_OK ? "restored" : "new");
+  Serial.print("count:\t");
+  Serial.println(logger.count());
+  Serial.println();
+
+  for (int s = 1; s < 9; s++)
+  {
+    uint32_t speed = s * 100000UL;
+    Serial.print("CLOCK: ");
+    Serial.println(speed);
+    Wire.setClock(speed);
+    test();
+  }
+  Wire.setClock(100000);
+
+  Serial.println("done...");
+}
+
+
+void loop()
+{
+}
+
+
+void test()
+{
+  logger.format();
+  // fill the log, the last appends overwrite
+  uint16_t n = logger.size() / (FRAM_LOGGER_HEADER_SIZE + sizeof(record)) + 10;
+  start = micros();
+  for (uint16_t i = 0; i < n; i++)
+  {
+    record.time = millis();
+    record.counter = i;
+    logger.append(&record, sizeof(record));
+  }
+  stop = micros();
+  Serial.print("  append us:\t");
+  Serial.println((stop - start) * 1.0 / n, 1);
+
+  start = micros();
+  uint32_t bytes = logger.exportRaw(nullPrint);
+  stop = micros();
+  Serial.print("  export KB/s:\t");
+  Serial.println(bytes * 1000.0 / (stop - start), 1);
+
+  logger.rewind();
+  start = micros();
+  uint16_t cnt = 0;
+  while (logger.readNext(&record, sizeof(record)) > 0) cnt++;
+  stop = micros();
+  Serial.print("  readNext us:\t");
+  Serial.println((stop - start) * 1.0 / cnt, 1);
+  Serial.println();
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,35 @@
+#pragma once
+//
+//    FILE: Arduino.h
+// PURPOSE: minimal host replacement so FRAM_I2C compiles with g++
+//
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define F(s)        (s)
+
+#define LOW         0
+#define HIGH        1
+#define OUTPUT      1
+
+inline void pinMode(uint8_t, uint8_t)       {};
+inline void digitalWrite(uint8_t, uint8_t)  {};
+inline int  digitalRead(uint8_t)           { return LOW; };
+
+
+class Print
+{
+public:
+  virtual ~Print() {};
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t * buffer, size_t size)
+  {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  };
+};
+
+// -- END OF FILE --
@@ -0,0 +1,83 @@
+#pragma once
+//
+//    FILE: Wire.h
+// PURPOSE: host replacement of Wire with one in-memory FRAM device
+//
+// the first two bytes of a write transaction set the memory address,
+// the next bytes are written, requestFrom() reads from that address.
+// writeBudget simulates a power loss, after that number of bytes
+// nothing is written anymore. -1 = no limit.
+// transactions and bits count the bus traffic, bits as
+// START + 9 bits per byte (incl. device address) + STOP.
+//
+
+#include "Arduino.h"
+
+
+#define FRAM_SHIM_ADDRESS       0x50
+#define BUFFER_LENGTH           32         // as AVR Wire
+
+
+class TwoWire
+{
+public:
+  uint8_t  memory[65536];
+  long     writeBudget  = -1;
+  uint32_t transactions = 0;
+  uint32_t bits         = 0;
+  bool     overflow     = false;   // transaction larger than BUFFER_LENGTH
+
+  void begin()  {};
+  void setClock(uint32_t)  {};
+
+  void beginTransmission(uint8_t address)
+  {
+    _device = (address == FRAM_SHIM_ADDRESS);
+    _count  = 0;
+  };
+
+  size_t write(uint8_t value)
+  {
+    if (_count == 0)      _pointer = value << 8;
+    else if (_count == 1) _pointer |= value;
+    else if (_device && (writeBudget != 0))
+    {
+      memory[_pointer++] = value;
+      if (writeBudget > 0) writeBudget--;
+    }
+    _count++;
+    return 1;
+  };
+
+  uint8_t endTransmission(bool stop = true)
+  {
+    (void) stop;
+    _traffic(_count);
+    return _device ? 0 : 2;
+  };
+
+  uint8_t requestFrom(uint8_t address, uint8_t size)
+  {
+    if (address != FRAM_SHIM_ADDRESS) return 0;
+    _traffic(size);
+    return size;
+  };
+
+  int read()  { return memory[_pointer++]; };
+
+private:
+  bool     _device  = false;
+  uint16_t _count   = 0;
+  uint16_t _pointer = 0;
+
+  void _traffic(uint16_t bytes)
+  {
+    if (bytes > BUFFER_LENGTH) overflow = true;
+    transactions++;
+    bits += 2 + 9 * (1 + bytes);
+  };
+};
+
+extern TwoWire Wire;
+
+// -- END OF FILE --
@@ -0,0 +1,316 @@
+//
+//    FILE: logger_test.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: host only round trip and power loss test of FRAMLogger
+//    DATE: 2021-09-17
+//     URL: https://github.com/RobTillaart/FRAM_I2C
+//
+// uses the real FRAM.cpp and FRAMLogger.cpp with an in-memory FRAM
+// behind a replacement Wire.h, see the shim for the power loss model.
+//
+// build and run on a PC (not an Arduino sketch):
+//   g++ -O2 -std=c++11 -I. -I../.. logger_test.cpp ../../FRAM.cpp ../../FRAMLogger.cpp -o logger_test
+//   ./logger_test
+//
+
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "FRAMLogger.h"
+
+
+TwoWire Wire;
+
+#define CHECK(c)                                              \
+  do { if (!(c)) {                                            \
+    printf("FAIL line %d: %s\n", __LINE__, #c); return false; \
+  } } while (0)
+
+
+// the payload follows from the sequence number, so any record
+// read back can be verified without a model.
+uint8_t recordLength(uint32_t seq, uint8_t maxLength)
+{
+  return 1 + (seq * 7919UL) % maxLength;
+}
+
+
+int append(FRAMLogger & logger, uint8_t maxLength)
+{
+  uint8_t buf[255];
+  uint32_t seq = logger.nextSeq();
+  uint8_t length = recordLength(seq, maxLength);
+  for (int i = 0; i < length; i++) buf[i] = seq * 31 + i;
+  return logger.append(buf, length);
+}
+
+
+// returns the number of valid records, negative if not as expected.
+int verify(FRAMLogger & logger, uint8_t maxLength)
+{
+  uint8_t  buf[255];
+  uint32_t seq;
+  uint32_t expect = logger.firstSeq();
+  int n = 0;
+  int length;
+  logger.rewind();
+  while ((length = logger.readNext(buf, 255, &seq)) > 0)
+  {
+    if (seq != expect) return -1;
+    if (length != recordLength(seq, maxLength)) return -2;
+    for (int i = 0; i < length; i++)
+    {
+      if (buf[i] != (uint8_t)(seq * 31 + i)) return -3;
+    }
+    expect++;
+    n++;
+  }
+  if (length < 0) return length;
+  if (n != logger.count()) return -4;
+  return n;
+}
+
+
+class Sink : public Print
+{
+public:
+  std::vector<uint8_t> data;
+  size_t write(uint8_t b)  { data.push_back(b); return 1; };
+  size_t write(const uint8_t * b, size_t n)  { data.insert(data.end(), b, b + n); return n; };
+};
+
+
+// uint16_t memaddr: a log of (almost) the whole FRAM wraps the address.
+FRAM fram;
+uint32_t randomState = 1;
+
+uint32_t rnd(uint32_t n)
+{
+  randomState = randomState * 1664525UL + 1013904223UL;
+  return (randomState >> 8) % n;
+}
+
+
+bool test_round_trip()
+{
+  FRAMLogger logger;
+  memset(Wire.memory, 0xFF, sizeof(Wire.memory));
+  CHECK(logger.begin(&fram, 100, 40) == FRAM_LOGGER_ERR_SIZE);
+  CHECK(logger.begin(&fram, 100, 1000) == FRAM_LOGGER_NEW);
+
+  for (int i = 0; i < 5000; i++)
+  {
+    CHECK(append(logger, 40) == FRAM_LOGGER_OK);
+    CHECK(verify(logger, 40) > 0);
+    CHECK(logger.used() <= logger.size());
+    if (i % 97 == 0)
+    {
+      FRAMLogger reload;
+      CHECK(reload.begin(&fram, 100, 1000) == FRAM_LOGGER_OK);
+      CHECK(reload.count() == logger.count());
+      CHECK(reload.nextSeq() == logger.nextSeq());
+      CHECK(verify(reload, 40) == logger.count());
+    }
+  }
+
+  // export = records as stored, oldest first
+  Sink sink;
+  CHECK(logger.exportRaw(sink) == logger.used());
+  CHECK(sink.data.size() == logger.used());
+  uint32_t seq = logger.firstSeq();
+  for (size_t pos = 0; pos < sink.data.size(); seq++)
+  {
+    uint32_t s = 0;
+    for (int i = 3; i >= 0; i--) s = (s << 8) | sink.data[pos + 1 + i];
+    CHECK(s == seq);
+    pos += FRAM_LOGGER_HEADER_SIZE + sink.data[pos];
+  }
+  CHECK(seq == logger.nextSeq());
+
+  uint16_t count = logger.count();
+  CHECK(logger.remove(3) == 3);
+  CHECK(verify(logger, 40) == count - 3);
+
+  logger.setOverwrite(false);
+  int full = 0;
+  for (int i = 0; i < 200; i++)
+  {
+    int rv = append(logger, 40);
+    if (rv == FRAM_LOGGER_FULL) full++;
+    else CHECK(rv == FRAM_LOGGER_OK);
+    CHECK(verify(logger, 40) == logger.count());
+  }
+  CHECK(full > 0);
+
+  // other size => new log
+  FRAMLogger other;
+  CHECK(other.begin(&fram, 100, 900) == FRAM_LOGGER_NEW);
+  CHECK(other.count() == 0);
+  return true;
+}
+
+
+// random log sizes and random append / remove / reload / overwrite.
+bool test_fuzz(int sizes, int operations)
+{
+  for (int s = 0; s < sizes; s++)
+  {
+    uint16_t size = 2 * FRAM_LOGGER_META_SIZE + 10 + rnd(3000);
+    uint16_t memaddr = rnd(65536UL - size);
+    uint16_t largest = size - 2 * FRAM_LOGGER_META_SIZE - FRAM_LOGGER_HEADER_SIZE;
+    uint8_t  maxLength = 1 + rnd((largest < 255) ? largest : 255);
+    FRAMLogger logger;
+    CHECK(logger.begin(&fram, memaddr, size) != FRAM_LOGGER_ERR_SIZE);
+    logger.format();
+
+    for (int op = 0; op < operations; op++)
+    {
+      uint32_t first = logger.firstSeq();
+      uint32_t next  = logger.nextSeq();
+      uint32_t r = rnd(100);
+      if (r < 70)
+      {
+        int rv = append(logger, maxLength);
+        if (rv == FRAM_LOGGER_OK) CHECK(logger.nextSeq() == next + 1);
+        else
+        {
+          CHECK((rv == FRAM_LOGGER_FULL) && !logger.getOverwrite());
+          CHECK(logger.nextSeq() == next);
+        }
+        CHECK(logger.firstSeq() >= first);
+      }
+      else if (r < 80)
+      {
+        uint16_t n = rnd(4);
+        uint16_t count = logger.count();
+        uint16_t removed = logger.remove(n);
+        CHECK(removed == ((n < count) ? n : count));
+      }
+      else if (r < 90)
+      {
+        logger.begin(&fram, memaddr, size);
+        CHECK(logger.nextSeq() == next);
+        CHECK(logger.firstSeq() == first);
+      }
+      else
+      {
+        logger.setOverwrite(!logger.getOverwrite());
+      }
+      CHECK(verify(logger, maxLength) >= 0);
+      CHECK(logger.used() <= logger.size());
+    }
+  }
+  return true;
+}
+
+
+// cut the power after every byte of an append and reload,
+// the log must be valid and hold the state from before or after.
+bool test_power_loss(int sizes)
+{
+  int torn = 0;
+  for (int s = 0; s < sizes; s++)
+  {
+    uint16_t size = 2 * FRAM_LOGGER_META_SIZE + 300 + rnd(700);
+    uint8_t  maxLength = 1 + rnd(255);
+    FRAMLogger logger;
+    logger.begin(&fram, 0, size);
+    logger.format();
+    for (int i = 0; i < 50; i++) append(logger, maxLength);
+
+    for (long budget = 0; ; budget++)
+    {
+      uint32_t first = logger.firstSeq();
+      uint32_t next  = logger.nextSeq();
+      Wire.writeBudget = budget;
+      append(logger, maxLength);
+      bool complete = (Wire.writeBudget != 0);
+      Wire.writeBudget = -1;
+
+      FRAMLogger reload;
+      CHECK(reload.begin(&fram, 0, size) == FRAM_LOGGER_OK);
+      CHECK(verify(reload, maxLength) >= 0);
+      CHECK((reload.nextSeq() == next) || (reload.nextSeq() == next + 1));
+      CHECK(reload.firstSeq() >= first);
+      if (complete)
+      {
+        CHECK(reload.nextSeq() == next + 1);
+        break;
+      }
+      torn++;
+      // continue with the log as found after the power loss
+      logger.begin(&fram, 0, size);
+    }
+  }
+  printf("power loss\t%d torn appends\n", torn);
+  return true;
+}
+
+
+bool test_performance()
+{
+  FRAMLogger logger;
+  memset(Wire.memory, 0xFF, sizeof(Wire.memory));
+  logger.begin(&fram, 0, 8192);
+  uint8_t rec[16] = { 0 };
+
+  printf("\nI2C time at 400 KHz, START + 9 bits per byte + STOP\n");
+  printf("action\t\t\ttrans.\tbits\tus\n");
+  Wire.transactions = 0;
+  Wire.bits = 0;
+  logger.append(rec, 16);
+  printf("append 16 bytes\t\t%u\t%u\t%.0f\n", Wire.transactions, Wire.bits, Wire.bits / 0.4);
+
+  // full log, every append evicts the oldest record
+  for (int i = 0; i < 1000; i++) logger.append(rec, 16);
+  Wire.transactions = 0;
+  Wire.bits = 0;
+  logger.append(rec, 16);
+  printf("append 16 bytes, full\t%u\t%u\t%.0f\n", Wire.transactions, Wire.bits, Wire.bits / 0.4);
+
+  Sink sink;
+  Wire.transactions = 0;
+  Wire.bits = 0;
+  uint32_t bytes = logger.exportRaw(sink);
+  printf("export %u bytes\t\t%u\t%u\t%.0f\t=> %.1f KB/s\n", bytes,
+         Wire.transactions, Wire.bits, Wire.bits / 0.4, bytes * 400.0 / Wire.bits);
+
+  const int N = 100000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < N; i++) logger.append(rec, 16);
+  std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+  printf("\nhost append 16 bytes\t%.3f us\n", duration.count() / N);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 100; i++)
+  {
+    sink.data.clear();
+    logger.exportRaw(sink);
+  }
+  duration = std::chrono::steady_clock::now() - start;
+  printf("host export\t\t%.1f MB/s\n", 100.0 * bytes / duration.count());
+  CHECK(Wire.overflow == false);
+  return true;
+}
+
+
+int main()
+{
+  printf("FRAM_LIB_VERSION: %s\n\n", FRAM_LIB_VERSION);
+
+  bool ok = (fram.begin(FRAM_SHIM_ADDRESS) == FRAM_OK);
+  ok = ok && test_round_trip();
+  printf("round trip\t%s\n", ok ? "OK" : "FAIL");
+  ok = ok && test_fuzz(200, 2000);
+  printf("fuzz\t\t%s\n", ok ? "OK" : "FAIL");
+  ok = ok && test_power_loss(20);
+  printf("power loss\t%s\n", ok ? "OK" : "FAIL");
+  ok = ok && test_performance();
+  printf("\n%s\n", ok ? "ALL OK" : "FAILED");
+  return ok ? 0 : 1;
+}
+
+
+// -- END OF FILE --
@@ -26,6 +26,7 @@
 
 #include "Arduino.h"
 #include "FRAM.h"
+#include "FRAMLogger.h"
 
 
 
@@ -84,6 +85,40 @@ unittest(test_constructor)
   assertEqual(0, fram50.getSize());
 }
 
+
+unittest(test_logger_blank)
+{
+  FRAM fram;
+  FRAMLogger logger;
+
+  Wire.begin();
+  assertEqual(FRAM_OK, fram.begin());
+
+  assertEqual(FRAM_LOGGER_ERR_SIZE, logger.begin(&fram, 0, 40));
+  // nothing connected reads as 0xFF => no valid meta data
+  assertEqual(FRAM_LOGGER_NEW, logger.begin(&fram, 0, 1000));
+  assertEqual(1000 - 2 * FRAM_LOGGER_META_SIZE, logger.size());
+  assertEqual(0, logger.count());
+  assertEqual(0, logger.used());
+  assertEqual(0, logger.nextSeq());
+  assertTrue(logger.getOverwrite());
+
+  uint8_t rec[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  assertEqual(FRAM_LOGGER_OK, logger.append(rec, 10));
+  assertEqual(FRAM_LOGGER_OK, logger.append(rec, 5));
+  assertEqual(2, logger.count());
+  assertEqual(0, logger.firstSeq());
+  assertEqual(2, logger.nextSeq());
+  assertEqual(2 * FRAM_LOGGER_HEADER_SIZE + 15, logger.used());
+
+  uint8_t big[255];
+  for (int i = 0; i < 255; i++) big[i] = i;
+  assertEqual(FRAM_LOGGER_OK, logger.append(big, 255));
+  logger.begin(&fram, 0, 200);
+  assertEqual(FRAM_LOGGER_ERR_SIZE, logger.append(big, 255));
+}
+
+
 unittest_main()
 
 // --------
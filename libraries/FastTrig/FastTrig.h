@@ -2,7 +2,7 @@
 //
 //    FILE: FastTrig.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.8
+// VERSION: 0.1.9
 // PURPOSE: Arduino library for a faster approximation of sin() and cos()
 //    DATE: 2011-08-18
 //     URL: https://github.com/RobTillaart/FastTrig
@@ -23,6 +23,7 @@
 //  0.1.7   2021-04-23  fix for PlatformIO
 //  0.1.8   2021-08-10  made % 180 conditional in itan() => performance gain
 //                      added icot() cotangent.
+//  0.1.9   2021-09-19  added isin16(), icos16() and iatan2_16(), integer only.
 
 
 #include "Arduino.h"
@@ -236,4 +237,94 @@ float iatan(float f)
   return 0 * f;
 }
 
+///////////////////////////////////////////////////////
+//
+// INTEGER GONIO
+//
+// angle = 0..65535 for one turn (0x4000 = 90 degrees)
+// sin, cos = Q15  -32767..32767
+// no float math, for FPU-less boards e.g. rotary encoders, motor control.
+//
+int16_t isin16(uint16_t angle)
+{
+  bool neg = (angle & 0x8000);
+  uint16_t a = angle & 0x7FFF;
+  if (a > 0x4000) a = 0x8000 - a;       // mirror 90..180 => 90..0
+  uint32_t p = (uint32_t)a * 90;        // degrees with 14 bit fraction
+  uint8_t  idx  = p >> 14;
+  uint16_t frac = p & 0x3FFF;
+  uint16_t v = isinTable16[idx];
+  if (frac != 0)
+  {
+    v += ((uint32_t)(isinTable16[idx + 1] - v) * frac + 0x2000) >> 14;
+  }
+  int16_t r = v >> 1;
+  if (neg) return -r;
+  return r;
+}
+
+int16_t icos16(uint16_t angle)
+{
+  return isin16(angle + 0x4000);
+}
+
+// ay * cos(d) - ax * sin(d), >= 0 as long as tan(d) <= ay / ax
+static int32_t _iatan2_f(uint16_t ay, uint16_t ax, uint8_t d)
+{
+  return (int32_t)((uint32_t)ay * isinTable16[90 - d]) - (int32_t)((uint32_t)ax * isinTable16[d]);
+}
+
+// returns angle 0..65535 as isin16(), iatan2_16(0, 0) == 0
+// binary search in isinTable16 for the octant, then interpolate.
+uint16_t iatan2_16(int16_t y, int16_t x)
+{
+  uint16_t ax = (x < 0) ? -x : x;
+  uint16_t ay = (y < 0) ? -y : y;
+  if ((ax | ay) == 0) return 0;
+  bool swap = (ay > ax);
+  if (swap)
+  {
+    uint16_t t = ax;
+    ax = ay;
+    ay = t;
+  }
+  // scale small vectors up for the precision of the fraction
+  while (ax < 0x4000)
+  {
+    ax <<= 1;
+    ay <<= 1;
+  }
+
+  // octant 0..45 degrees
+  uint8_t lo = 0;
+  uint8_t hi = 45;
+  while (hi - lo > 1)
+  {
+    uint8_t mi = (lo + hi) / 2;
+    if (_iatan2_f(ay, ax, mi) >= 0) lo = mi;
+    else hi = mi;
+  }
+  uint16_t a;   // 256 units per degree
+  int32_t f = _iatan2_f(ay, ax, lo);
+  if (_iatan2_f(ay, ax, hi) >= 0)
+  {
+    a = hi * 256;    // 45 degrees
+  }
+  else
+  {
+    uint32_t den = (uint32_t)ay * (isinTable16[90 - lo] - isinTable16[89 - lo])
+                 + (uint32_t)ax * (isinTable16[lo + 1] - isinTable16[lo]);
+    uint16_t frac = ((uint32_t)f << 4) / (den >> 4);
+    if (frac > 255) frac = 255;
+    a = lo * 256 + frac;
+  }
+  // 256 per degree => 65536 per turn,  65536 / 92160 == 46603 / 65536
+  a = ((uint32_t)a * 46603 + 0x8000) >> 16;
+  if (swap) a = 0x4000 - a;
+  if (x < 0) a = 0x8000 - a;
+  if (y < 0) a = -a;
+  return a;
+}
+
+
 // -- END OF FILE --
@@ -0,0 +1,111 @@
+//
+//    FILE: fastTrig_int16.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: performance and error of isin16(), icos16() and iatan2_16()
+//    DATE: 2021-09-19
+//    (c) : MIT
+//
+// angle 0..65535 = one turn, sin / cos in Q15
+
+
+#include "FastTrig.h"
+
+uint32_t start;
+
+volatile float x;
+volatile int16_t y;
+volatile uint16_t z;
+long i;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println();
+
+  test_performance();
+  test_error();
+
+  Serial.println("done...\n");
+}
+
+
+void loop()
+{
+}
+
+
+void test_performance()
+{
+  Serial.println(__FUNCTION__);
+  Serial.println("us per call, 1024 calls over one turn");
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) x = sin(i * (TWO_PI / 65536));
+  Serial.print("sin\t");
+  Serial.println((micros() - start) / 1024.0);
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) x = isin(i * (360.0 / 65536));
+  Serial.print("isin\t");
+  Serial.println((micros() - start) / 1024.0);
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) y = isin16(i);
+  Serial.print("isin16\t");
+  Serial.println((micros() - start) / 1024.0);
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) y = icos16(i);
+  Serial.print("icos16\t");
+  Serial.println((micros() - start) / 1024.0);
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) x = atan2(i - 32768, 10000);
+  Serial.print("atan2\t");
+  Serial.println((micros() - start) / 1024.0);
+  delay(10);
+
+  start = micros();
+  for (i = 0; i < 65536; i += 64) z = iatan2_16(i - 32768, 10000);
+  Serial.print("iatan2_16\t");
+  Serial.println((micros() - start) / 1024.0);
+  Serial.println();
+  delay(10);
+}
+
+
+void test_error()
+{
+  Serial.println(__FUNCTION__);
+  float mxs = 0, mxa = 0;
+  for (i = 0; i < 65536; i += 16)
+  {
+    float t = i * (TWO_PI / 65536);
+    float e = abs(sin(t) * 32767 - isin16(i));
+    if (e > mxs) mxs = e;
+
+    int16_t sy = round(sin(t) * 30000);
+    int16_t sx = round(cos(t) * 30000);
+    float ref = atan2(sy, sx) * (65536 / TWO_PI);
+    if (ref < 0) ref += 65536;
+    e = abs(iatan2_16(sy, sx) - ref);
+    if (e > 32768) e = 65536 - e;
+    if (e > mxa) mxa = e;
+  }
+  Serial.print("isin16 max error LSB:\t");
+  Serial.println(mxs, 2);
+  Serial.print("iatan2_16 max error units:\t");
+  Serial.println(mxa, 2);
+  Serial.println();
+}
+
+
+// -- END OF FILE --
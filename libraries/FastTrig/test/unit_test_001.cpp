@@ -85,6 +85,55 @@ unittest(test_max_error_table8)
   assertEqualFloat(0, m, 0.01);
 }
 
+unittest(test_isin16_icos16)
+{
+  fprintf(stderr,"isin16 icos16 error < 4 LSB\n");
+  for (long a = 0; a < 65536; a += 37)
+  {
+    assertEqualFloat(sin(a * TWO_PI / 65536) * 32767, isin16(a), 4);
+    assertEqualFloat(cos(a * TWO_PI / 65536) * 32767, icos16(a), 4);
+  }
+  assertEqual(0, isin16(0));
+  assertEqual(32767, isin16(0x4000));
+  assertEqual(0, isin16(0x8000));
+  assertEqual(-32767, isin16(0xC000));
+  assertEqual(32767, icos16(0));
+  assertEqual(-32767, icos16(0x8000));
+}
+
+
+unittest(test_iatan2_16)
+{
+  fprintf(stderr,"iatan2_16 error < 2 units (0.011 degree)\n");
+  assertEqual(0, iatan2_16(0, 0));
+  assertEqual(0, iatan2_16(0, 100));
+  assertEqual(16384, iatan2_16(100, 0));
+  assertEqual(32768, iatan2_16(0, -100));
+  assertEqual(49152, iatan2_16(-100, 0));
+  assertEqual(8192, iatan2_16(5, 5));
+  assertEqual(40960, iatan2_16(-32768, -32768));
+
+  for (long a = 0; a < 65536; a += 41)
+  {
+    float t = a * TWO_PI / 65536;
+    int16_t y = round(sin(t) * 30000);
+    int16_t x = round(cos(t) * 30000);
+    float ref = atan2(y, x) * 65536 / TWO_PI;
+    if (ref < 0) ref += 65536;
+    float e = iatan2_16(y, x) - ref;
+    if (e > 32768)  e -= 65536;
+    if (e < -32768) e += 65536;
+    assertEqualFloat(0, e, 2);
+  }
+  // round trip
+  for (long a = 0; a < 65536; a += 101)
+  {
+    int16_t e = iatan2_16(isin16(a), icos16(a)) - a;
+    assertEqualFloat(0, e, 3);
+  }
+}
+
+
 unittest_main()
 
 // --------
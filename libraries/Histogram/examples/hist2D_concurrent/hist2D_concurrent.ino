@@ -0,0 +1,94 @@
+//
+//    FILE: hist2D_concurrent.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-15
+//
+// PUPROSE: ingestion speed with 1 and 2 tasks, sharded versus atomic
+//
+// ESP32 only (FreeRTOS, two cores)
+//
+
+#if !defined(ESP32)
+#error "this example needs an ESP32"
+#endif
+
+
+#include "histogram2D.h"
+
+
+#define SAMPLES     100000
+
+float bx[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90 };
+float by[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90 };
+
+Histogram2D hist(9, bx, 9, by, 2);
+
+uint32_t done = 0;    // written by both cores, atomic access only
+bool useAtomic = false;
+
+
+void worker(void * param)
+{
+  uint8_t shard = (uint32_t) param;
+  uint32_t seed = shard + 1;
+  for (uint32_t i = 0; i < SAMPLES; i++)
+  {
+    seed = seed * 1664525UL + 1013904223UL;
+    float x = (seed >> 16) % 100;
+    float y = (seed >> 8) % 100;
+    if (useAtomic) hist.addAtomic(x, y);
+    else hist.add(x, y, shard);
+  }
+  __atomic_fetch_add(&done, 1, __ATOMIC_RELEASE);
+  vTaskDelete(NULL);
+}
+
+
+void run(uint8_t tasks, bool atomic)
+{
+  hist.clear();
+  useAtomic = atomic;
+  __atomic_store_n(&done, 0, __ATOMIC_RELAXED);
+  uint32_t start = micros();
+  for (uint8_t t = 0; t < tasks; t++)
+  {
+    xTaskCreatePinnedToCore(worker, "worker", 2048, (void *)(uint32_t)t, 1, NULL, t);
+  }
+  while (__atomic_load_n(&done, __ATOMIC_ACQUIRE) < tasks) delay(1);
+  uint32_t duration = micros() - start;
+
+  Serial.print(tasks);
+  Serial.print("\t");
+  Serial.print(atomic ? "atomic" : "shard");
+  Serial.print("\t");
+  Serial.print(hist.count());
+  Serial.print("\t");
+  Serial.println(1e6 * hist.count() / duration, 0);
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("HISTOGRAM_LIB_VERSION: ");
+  Serial.println(HISTOGRAM_LIB_VERSION);
+  Serial.println();
+  Serial.println("TASKS\tMODE\tCOUNT\tADDS/SEC");
+
+  run(1, false);
+  run(2, false);
+  run(1, true);
+  run(2, true);
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
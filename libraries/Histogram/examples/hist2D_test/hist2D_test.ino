@@ -0,0 +1,69 @@
+//
+//    FILE: hist2D_test.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-15
+//
+// PUPROSE: joint distribution of temperature and humidity
+//
+
+#include "histogram2D.h"
+
+// boundaries does not need to be equally distributed.
+float temperature[] = { 0, 10, 15, 20, 25, 30 };
+float humidity[]    = { 20, 40, 60, 80 };
+
+Histogram2D hist(6, temperature, 4, humidity);
+
+uint32_t lastTime = 0;
+const uint32_t threshold = 5000;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("HISTOGRAM_LIB_VERSION: ");
+  Serial.println(HISTOGRAM_LIB_VERSION);
+  Serial.println();
+}
+
+
+void loop()
+{
+  // simulated sensor, humidity drops when it gets warmer
+  float t = random(0, 350) * 0.1;
+  float h = 90 - 2 * t + random(-100, 100) * 0.1;
+  hist.add(t, h);
+
+  if (millis() - lastTime > threshold)
+  {
+    lastTime = millis();
+    Serial.print("\tT <= ");
+    for (int ix = 0; ix < hist.sizeX() - 1; ix++)
+    {
+      Serial.print(temperature[ix], 0);
+      Serial.print("\t");
+    }
+    Serial.println("> ");
+    for (int iy = hist.sizeY() - 1; iy >= 0; iy--)
+    {
+      if (iy < hist.sizeY() - 1)
+      {
+        Serial.print("H<=");
+        Serial.print(humidity[iy], 0);
+      }
+      else Serial.print("H>");
+      for (int ix = 0; ix < hist.sizeX(); ix++)
+      {
+        Serial.print("\t");
+        Serial.print(hist.frequency(ix, iy) * 100, 1);
+      }
+      Serial.println();
+    }
+    Serial.println();
+  }
+}
+
+
+// -- END OF FILE --
@@ -1,7 +1,7 @@
 //
 //    FILE: Histogram.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.2.1
+// VERSION: 0.2.2
 // PURPOSE: Histogram library for Arduino
 //    DATE: 2012-11-10
 //
@@ -15,6 +15,7 @@
 //  0.1.6   2017-07-27  revert double to float (issue #33)
 //  0.2.0   2020-06-12  #pragma once, removed pre 1.0 support
 //  0.2.1   2020-12-24  arduino-ci + unit tests
+//  0.2.2   2021-09-15  add merge(), add Histogram2D with shards for concurrent use
 
 
 #include "histogram.h"
@@ -138,4 +139,13 @@ int16_t Histogram::find(const float val)
   // return i;
 }
 
+// adds the counts of other to this histogram
+bool Histogram::merge(Histogram & other)
+{
+  if ((_len == 0) || (other._len != _len)) return false;
+  for (int16_t i = 0; i < _len; i++) _data[i] += other._data[i];
+  _cnt += other._cnt;
+  return true;
+}
+
 // -- END OF FILE --
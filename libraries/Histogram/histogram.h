@@ -2,14 +2,14 @@
 //
 //    FILE: Histogram.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.2.1
+// VERSION: 0.2.2
 // PURPOSE: Histogram library for Arduino
 //    DATE: 2012-11-10
 //
 
 #include "Arduino.h"
 
-#define HISTOGRAM_LIB_VERSION "0.2.1"
+#define HISTOGRAM_LIB_VERSION "0.2.2"
 
 class Histogram
 {
@@ -35,6 +35,9 @@ public:
   float   VAL(const float prob);
   int16_t find(const float f);
 
+  // adds the counts of other, same number of buckets needed.
+  bool    merge(Histogram & other);
+
 protected:
   float *   _bounds;
   int32_t * _data;
@@ -0,0 +1,147 @@
+//
+//    FILE: Histogram2D.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.2.2
+// PURPOSE: Histogram2D library for Arduino, joint distribution of two values
+//    DATE: 2021-09-15
+//
+// Every shard is a complete histogram with its own count, a writer thread
+// owns one shard so it can increment without locks or atomics.
+// Reads sum the shards.
+//
+
+#include "histogram2D.h"
+
+Histogram2D::Histogram2D(const int16_t lenX, float *boundsX, const int16_t lenY, float *boundsY, const uint8_t shards)
+{
+  _boundsX = boundsX;
+  _boundsY = boundsY;
+  _lenX = lenX + 1;
+  _lenY = lenY + 1;
+  _shards = (shards == 0) ? 1 : shards;
+  _size = (uint32_t)_lenX * _lenY;
+  // malloc() does not align to a cache line, so a guard of a full line
+  // between the last counter of a shard and the first of the next one.
+  _stride = _size + 1;
+  if (_shards > 1)
+  {
+    _stride = ((_size + 2 * HISTOGRAM2D_SHARD_PAD) / HISTOGRAM2D_SHARD_PAD) * HISTOGRAM2D_SHARD_PAD;
+  }
+  _data = (int32_t *) malloc(_shards * _stride * sizeof(int32_t));
+  if (_data == NULL)
+  {
+    _size = 0;
+    _stride = 0;
+    _lenX = 0;
+    _lenY = 0;
+    _shards = 0;
+  }
+  clear();
+}
+
+Histogram2D::~Histogram2D()
+{
+  if (_data) free(_data);
+}
+
+// resets all counters of all shards
+void Histogram2D::clear()
+{
+  uint32_t n = _shards * _stride;
+  for (uint32_t i = 0; i < n; i++) _data[i] = 0;
+}
+
+void Histogram2D::add(const float x, const float y, const uint8_t shard)
+{
+  if ((_size == 0) || (shard >= _shards)) return;
+  int32_t * p = &_data[shard * _stride];
+  p[index(findX(x), findY(y))]++;
+  p[_size]++;
+}
+
+void Histogram2D::sub(const float x, const float y)
+{
+  if (_size == 0) return;
+  _data[index(findX(x), findY(y))]--;
+  _data[_size]++;
+}
+
+uint32_t Histogram2D::count()
+{
+  uint32_t sum = 0;
+  for (uint8_t s = 0; s < _shards; s++) sum += _data[s * _stride + _size];
+  return sum;
+}
+
+int32_t Histogram2D::bucket(const int16_t ix, const int16_t iy)
+{
+  if ((ix < 0) || (ix >= _lenX) || (iy < 0) || (iy >= _lenY)) return 0;
+  int32_t sum = 0;
+  uint32_t i = index(ix, iy);
+  for (uint8_t s = 0; s < _shards; s++)
+  {
+    sum += _data[i];
+    i += _stride;
+  }
+  return sum;
+}
+
+float Histogram2D::frequency(const int16_t ix, const int16_t iy)
+{
+  uint32_t cnt = count();
+  if (cnt == 0) return NAN;
+  return (1.0 * bucket(ix, iy)) / cnt;
+}
+
+int32_t Histogram2D::bucketX(const int16_t ix)
+{
+  int32_t sum = 0;
+  for (int16_t iy = 0; iy < _lenY; iy++) sum += bucket(ix, iy);
+  return sum;
+}
+
+int32_t Histogram2D::bucketY(const int16_t iy)
+{
+  int32_t sum = 0;
+  for (int16_t ix = 0; ix < _lenX; ix++) sum += bucket(ix, iy);
+  return sum;
+}
+
+int16_t Histogram2D::findX(const float x)
+{
+  return _find(_boundsX, _lenX, x);
+}
+
+int16_t Histogram2D::findY(const float y)
+{
+  return _find(_boundsY, _lenY, y);
+}
+
+// merges all shards of other into shard 0
+bool Histogram2D::merge(Histogram2D & other)
+{
+  if ((_size == 0) || (other._lenX != _lenX) || (other._lenY != _lenY)) return false;
+  for (uint8_t s = 0; s < other._shards; s++)
+  {
+    // includes the count
+    int32_t * src = &other._data[s * other._stride];
+    for (uint32_t i = 0; i <= _size; i++) _data[i] += src[i];
+  }
+  return true;
+}
+
+// same as Histogram::find(), first bound >= val, binary search.
+int16_t Histogram2D::_find(const float * bounds, const int16_t len, const float val)
+{
+  int16_t lo = 0;
+  int16_t hi = len - 1;   // last bucket = above all bounds
+  while (lo < hi)
+  {
+    int16_t mid = (lo + hi) / 2;
+    if (bounds[mid] >= val) hi = mid;
+    else lo = mid + 1;
+  }
+  return lo;
+}
+
+// -- END OF FILE --
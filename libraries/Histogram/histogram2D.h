@@ -0,0 +1,73 @@
+#pragma once
+//
+//    FILE: Histogram2D.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.2.2
+// PURPOSE: Histogram2D library for Arduino, joint distribution of two values
+//    DATE: 2021-09-15
+//
+
+#include "histogram.h"
+
+
+// 64 byte cache line
+#define HISTOGRAM2D_SHARD_PAD     16
+
+
+class Histogram2D
+{
+public:
+  // shards > 1 gives every thread / task its own counters, see add(x, y, shard)
+  Histogram2D(const int16_t lenX, float *boundsX, const int16_t lenY, float *boundsY, const uint8_t shards = 1);
+  ~Histogram2D();
+
+  void  clear();
+  void  add(const float x, const float y)  { add(x, y, 0); };
+  void  sub(const float x, const float y);
+  // shard must only be written by one thread, no locking needed.
+  void  add(const float x, const float y, const uint8_t shard);
+  // any thread, relaxed atomic increment on shard 0.
+  // inline so boards without 32 bit atomics only fail if it is used.
+  void  addAtomic(const float x, const float y)
+  {
+    if (_size == 0) return;
+    __atomic_fetch_add(&_data[index(findX(x), findY(y))], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&_data[_size], 1, __ATOMIC_RELAXED);
+  };
+
+  // number of buckets per dimension
+  inline int16_t sizeX()    { return _lenX; };
+  inline int16_t sizeY()    { return _lenY; };
+  inline uint8_t shards()   { return _shards; };
+
+  // reads merge the shards
+  uint32_t count();
+  int32_t  bucket(const int16_t ix, const int16_t iy);
+  float    frequency(const int16_t ix, const int16_t iy);
+  // distribution of one value, summed over the other
+  int32_t  bucketX(const int16_t ix);
+  int32_t  bucketY(const int16_t iy);
+
+  int16_t  findX(const float x);
+  int16_t  findY(const float y);
+
+  // adds the counts of other, same number of buckets needed.
+  bool     merge(Histogram2D & other);
+
+protected:
+  int16_t  _find(const float * bounds, const int16_t len, const float val);
+  inline uint32_t index(const int16_t ix, const int16_t iy)  { return (uint32_t)iy * _lenX + ix; };
+
+  float *    _boundsX;
+  float *    _boundsY;
+  int16_t    _lenX;
+  int16_t    _lenY;
+  uint8_t    _shards;
+  uint32_t   _size;      // buckets per shard
+  // shard = [lenY][lenX] buckets + count + at least one cache line
+  // padding, so shards do not share a cache line (shards > 1).
+  uint32_t   _stride;
+  int32_t *  _data;
+};
+
+// -- END OF FILE --
@@ -26,6 +26,7 @@
 
 #include "Arduino.h"
 #include "histogram.h"
+#include "histogram2D.h"
 
 
 
@@ -98,6 +99,104 @@ unittest(test_dice)
   }
 }
 
+unittest(test_merge)
+{
+  float diceValues[] = { 0.5, 1.5, 2.5, 3.5, 4.5, 5.5 };
+  Histogram A(6, diceValues);
+  Histogram B(6, diceValues);
+  Histogram C(5, diceValues);
+  for (int d = 0; d < 70; d++) A.add(d % 7);
+  for (int d = 0; d < 7; d++) B.add(d);
+  assertTrue(A.merge(B));
+  assertFalse(A.merge(C));
+  assertEqual(77, A.count());
+  for (int i = 0; i < 7; i++)
+  {
+    assertEqual(11, A.bucket(i));
+  }
+}
+
+
+unittest(test_2D)
+{
+  float temperature[] = { 0, 10, 20, 30 };      // 5 buckets
+  float humidity[]    = { 25, 50, 75 };         // 4 buckets
+  Histogram2D H(4, temperature, 3, humidity);
+  assertEqual(5, H.sizeX());
+  assertEqual(4, H.sizeY());
+  assertEqual(1, H.shards());
+  assertEqual(0, H.count());
+  assertNAN(H.frequency(0, 0));
+
+  // find() same as the 1D version
+  Histogram T(4, temperature);
+  for (float t = -5; t < 40; t += 0.5)
+  {
+    assertEqual(T.find(t), H.findX(t));
+  }
+
+  H.add(15, 60);
+  H.add(15, 60);
+  H.add(-3, 90);
+  H.add(35, 10);
+  H.add(20, 50);      // on the bounds
+  assertEqual(5, H.count());
+  assertEqual(2, H.bucket(2, 2));
+  assertEqual(1, H.bucket(0, 3));
+  assertEqual(1, H.bucket(4, 0));
+  assertEqual(1, H.bucket(2, 1));
+  assertEqual(0, H.bucket(5, 0));     // out of range
+  assertEqual(3, H.bucketX(2));
+  assertEqual(1, H.bucketY(3));
+  assertEqualFloat(0.4, H.frequency(2, 2), 0.0001);
+
+  H.sub(15, 60);
+  assertEqual(1, H.bucket(2, 2));
+
+  H.clear();
+  assertEqual(0, H.count());
+  assertEqual(0, H.bucket(2, 2));
+}
+
+
+unittest(test_2D_shards)
+{
+  float bx[] = { 1, 2, 3 };
+  float by[] = { 1, 2, 3 };
+  Histogram2D H(3, bx, 3, by, 4);
+  assertEqual(4, H.shards());
+
+  // every "thread" writes its own shard
+  for (int s = 0; s < 4; s++)
+  {
+    for (int i = 0; i < 100; i++) H.add(i % 4 + 0.5, s + 0.5, s);
+  }
+  H.add(0, 0, 4);   // no such shard => ignored
+  H.addAtomic(3.5, 3.5);
+  assertEqual(401, H.count());
+  for (int ix = 0; ix < 4; ix++)
+  {
+    assertEqual(100, H.bucketX(ix) - (ix == 3 ? 1 : 0));
+  }
+  assertEqual(25, H.bucket(2, 2));
+  assertEqual(26, H.bucket(3, 3));
+
+  // merge all shards of H into one histogram
+  Histogram2D M(3, bx, 3, by);
+  Histogram2D W(2, bx, 3, by);
+  assertTrue(M.merge(H));
+  assertFalse(M.merge(W));
+  assertEqual(401, M.count());
+  for (int ix = 0; ix < 4; ix++)
+  {
+    for (int iy = 0; iy < 4; iy++)
+    {
+      assertEqual(H.bucket(ix, iy), M.bucket(ix, iy));
+    }
+  }
+}
+
+
 unittest_main()
 
 // --------
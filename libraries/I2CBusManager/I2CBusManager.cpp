@@ -0,0 +1,175 @@
+//
+//    FILE: I2CBusManager.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-01
+// VERSION: 0.1.0
+// PURPOSE: Arduino library to share one I2C bus between devices with different max speeds
+//     URL: https://github.com/RobTillaart/I2CBusManager
+//
+//  HISTORY:
+//  0.1.0   2021-09-01  initial version
+
+
+#include "I2CBusManager.h"
+
+
+I2CBusManager::I2CBusManager(TwoWire *wire)
+{
+  _wire = wire;
+  resetStatistics();
+}
+
+
+/////////////////////////////////////////////////////
+//
+// DEVICES
+//
+bool I2CBusManager::addDevice(const uint8_t address, uint32_t maxSpeed)
+{
+  for (uint8_t i = 0; i < _devices; i++)
+  {
+    if (_address[i] == address)
+    {
+      _speed[i] = maxSpeed;
+      return true;
+    }
+  }
+  if (_devices >= I2CBUSMANAGER_MAX_DEVICES) return false;
+  _address[_devices] = address;
+  _speed[_devices]   = maxSpeed;
+  _devices++;
+  return true;
+}
+
+
+uint32_t I2CBusManager::getMaxSpeed(const uint8_t address)
+{
+  for (uint8_t i = 0; i < _devices; i++)
+  {
+    if (_address[i] == address) return _speed[i];
+  }
+  return _defaultSpeed;
+}
+
+
+void I2CBusManager::select(const uint8_t address)
+{
+  _setClock(getMaxSpeed(address));
+}
+
+
+/////////////////////////////////////////////////////
+//
+// JOBS
+//
+bool I2CBusManager::addJob(const uint8_t address, I2CBusJob job, void * context)
+{
+  if (job == NULL) return false;
+  if (_jobs >= I2CBUSMANAGER_MAX_JOBS) return false;
+  _job[_jobs]      = job;
+  _context[_jobs]  = context;
+  _jobSpeed[_jobs] = getMaxSpeed(address);
+  _jobStart[_jobs] = millis();
+  _jobWait[_jobs]  = 0;
+  _jobs++;
+  return true;
+}
+
+
+uint8_t I2CBusManager::run()
+{
+  uint32_t now = millis();
+  uint8_t  count = 0;
+  if (_clock != 0)
+  {
+    count = _runSpeed(_clock, now);
+  }
+  // first job that is due determines the next speed.
+  for (uint8_t i = 0; i < _jobs; i++)
+  {
+    if (_due(i, now))
+    {
+      count += _runSpeed(_jobSpeed[i], now);
+      break;
+    }
+  }
+  return count;
+}
+
+
+/////////////////////////////////////////////////////
+//
+// STATISTICS
+//
+void I2CBusManager::resetStatistics()
+{
+  _clockSwitches = 0;
+  _jobSteps      = 0;
+}
+
+
+/////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+void I2CBusManager::_setClock(uint32_t speed)
+{
+  if (speed == _clock) return;
+  _wire->setClock(speed);
+  _clock = speed;
+  _clockSwitches++;
+}
+
+
+uint8_t I2CBusManager::_runSpeed(uint32_t speed, uint32_t now)
+{
+  uint8_t count = 0;
+  uint8_t i = 0;
+  while (i < _jobs)
+  {
+    if ((_jobSpeed[i] != speed) || !_due(i, now))
+    {
+      i++;
+      continue;
+    }
+    _setClock(speed);
+    uint16_t wait = _job[i](_context[i]);
+    _jobSteps++;
+    count++;
+    if (wait == 0)
+    {
+      _removeJob(i);
+      continue;        // next job moved to index i
+    }
+    // wait starts after the job, e.g. the AGS02MA 30 ms after the request.
+    now = millis();
+    _jobStart[i] = now;
+    _jobWait[i]  = wait;
+    i++;
+  }
+  return count;
+}
+
+
+// signed, a job rescheduled after now is not due (no underflow).
+bool I2CBusManager::_due(uint8_t idx, uint32_t now)
+{
+  return (int32_t)(now - _jobStart[idx]) >= (int32_t)_jobWait[idx];
+}
+
+
+void I2CBusManager::_removeJob(uint8_t idx)
+{
+  _jobs--;
+  for (uint8_t i = idx; i < _jobs; i++)
+  {
+    _job[i]      = _job[i + 1];
+    _context[i]  = _context[i + 1];
+    _jobSpeed[i] = _jobSpeed[i + 1];
+    _jobStart[i] = _jobStart[i + 1];
+    _jobWait[i]  = _jobWait[i + 1];
+  }
+}
+
+
+// -- END OF FILE --
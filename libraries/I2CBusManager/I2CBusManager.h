@@ -0,0 +1,95 @@
+#pragma once
+//
+//    FILE: I2CBusManager.h
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-01
+// VERSION: 0.1.0
+// PURPOSE: Arduino library to share one I2C bus between devices with different max speeds
+//     URL: https://github.com/RobTillaart/I2CBusManager
+//
+
+
+#include "Arduino.h"
+#include "Wire.h"
+
+
+#define I2CBUSMANAGER_LIB_VERSION         (F("0.1.0"))
+
+#ifndef I2CBUSMANAGER_MAX_DEVICES
+#define I2CBUSMANAGER_MAX_DEVICES         8
+#endif
+
+#ifndef I2CBUSMANAGER_MAX_JOBS
+#define I2CBUSMANAGER_MAX_JOBS            8
+#endif
+
+
+// a job does one or more I2C transactions with one device.
+// returns the number of milliseconds before it wants to be called again.
+// returns 0 when the job is done.
+typedef uint16_t (*I2CBusJob)(void * context);
+
+
+class I2CBusManager
+{
+public:
+  explicit I2CBusManager(TwoWire *wire = &Wire);
+
+  // speed used for devices that are not added.
+  void     setDefaultSpeed(uint32_t speed) { _defaultSpeed = speed; };
+  uint32_t getDefaultSpeed() { return _defaultSpeed; };
+
+
+  // DEVICES
+  // maxSpeed in Hz, adding an existing address updates its speed.
+  bool     addDevice(const uint8_t address, uint32_t maxSpeed);
+  uint32_t getMaxSpeed(const uint8_t address);
+  uint8_t  deviceCount() { return _devices; };
+
+  // sets the bus clock for the device, only calls setClock() on change.
+  void     select(const uint8_t address);
+  uint32_t getClock() { return _clock; };
+
+
+  // JOBS
+  bool     addJob(const uint8_t address, I2CBusJob job, void * context = NULL);
+  uint8_t  jobCount() { return _jobs; };
+  // call as often as possible, returns the number of job steps executed.
+  // due jobs at the current clock run first, then all due jobs of
+  // one other speed, so the clock switches at most once per call.
+  uint8_t  run();
+
+
+  // STATISTICS
+  uint32_t getClockSwitches() { return _clockSwitches; };
+  uint32_t getJobSteps()      { return _jobSteps; };
+  void     resetStatistics();
+
+
+private:
+  TwoWire * _wire;
+  uint32_t  _clock         = 0;
+  uint32_t  _defaultSpeed  = 100000;
+
+  uint8_t   _devices       = 0;
+  uint8_t   _address[I2CBUSMANAGER_MAX_DEVICES];
+  uint32_t  _speed[I2CBUSMANAGER_MAX_DEVICES];
+
+  uint8_t   _jobs          = 0;
+  I2CBusJob _job[I2CBUSMANAGER_MAX_JOBS];
+  void *    _context[I2CBUSMANAGER_MAX_JOBS];
+  uint32_t  _jobSpeed[I2CBUSMANAGER_MAX_JOBS];
+  uint32_t  _jobStart[I2CBUSMANAGER_MAX_JOBS];
+  uint16_t  _jobWait[I2CBUSMANAGER_MAX_JOBS];
+
+  uint32_t  _clockSwitches = 0;
+  uint32_t  _jobSteps      = 0;
+
+  void     _setClock(uint32_t speed);
+  uint8_t  _runSpeed(uint32_t speed, uint32_t now);
+  void     _removeJob(uint8_t idx);
+  bool     _due(uint8_t idx, uint32_t now);
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,102 @@
+//
+//    FILE: I2CBusManager_mixed_bus.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: measure bus usage with a slow and a fast device
+//    DATE: 2021-09-01
+//     URL: https://github.com/RobTillaart/I2CBusManager
+//
+// slow device at 0x1A (e.g. AGS02MA), fast device at 0x20 (e.g. PCF8574)
+
+
+#include "I2CBusManager.h"
+
+
+I2CBusManager BM;
+
+uint8_t  fastAddress = 0x20;
+uint8_t  slowAddress = 0x1A;
+uint8_t  slowState   = 0;
+
+uint32_t fastReads   = 0;
+uint32_t slowReads   = 0;
+uint32_t lastFast    = 0;
+uint32_t lastSlow    = 0;
+uint32_t lastPrint   = 0;
+
+
+uint16_t fastJob(void * context)
+{
+  Wire.requestFrom(fastAddress, (uint8_t)1);
+  Wire.read();
+  fastReads++;
+  return 0;
+}
+
+
+uint16_t slowJob(void * context)
+{
+  if (slowState == 0)
+  {
+    Wire.beginTransmission(slowAddress);
+    Wire.write(0x00);
+    Wire.endTransmission();
+    slowState = 1;
+    return 30;
+  }
+  Wire.requestFrom(slowAddress, (uint8_t)5);
+  while (Wire.available()) Wire.read();
+  slowReads++;
+  slowState = 0;
+  return 0;
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("I2CBUSMANAGER_LIB_VERSION: ");
+  Serial.println(I2CBUSMANAGER_LIB_VERSION);
+
+  Wire.begin();
+
+  BM.addDevice(slowAddress, 30000);
+  BM.addDevice(fastAddress, 400000);
+}
+
+
+void loop()
+{
+  uint32_t now = millis();
+  if (now - lastFast >= 10)
+  {
+    lastFast = now;
+    BM.addJob(fastAddress, fastJob);
+  }
+  if ((now - lastSlow >= 100) && (slowState == 0))
+  {
+    lastSlow = now;
+    BM.addJob(slowAddress, slowJob);
+  }
+  BM.run();
+
+  if (now - lastPrint >= 1000)
+  {
+    lastPrint = now;
+    Serial.print("fast: ");
+    Serial.print(fastReads);
+    Serial.print("\tslow: ");
+    Serial.print(slowReads);
+    Serial.print("\tswitches: ");
+    Serial.print(BM.getClockSwitches());
+    Serial.print("\tsteps: ");
+    Serial.println(BM.getJobSteps());
+    fastReads = 0;
+    slowReads = 0;
+    BM.resetStatistics();
+  }
+}
+
+
+// -- END OF FILE --
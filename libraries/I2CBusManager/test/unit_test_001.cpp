@@ -0,0 +1,266 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-01
+// PURPOSE: unit tests for the I2CBusManager library
+//          https://github.com/RobTillaart/I2CBusManager
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+#include <ArduinoUnitTests.h>
+
+
+#include "I2CBusManager.h"
+
+
+// fast device, one transaction per job
+uint32_t fastReads = 0;
+
+uint16_t fastJob(void * context)
+{
+  uint8_t address = *(uint8_t *)context;
+  Wire.beginTransmission(address);
+  Wire.write(0x00);
+  Wire.endTransmission();
+  fastReads++;
+  return 0;
+}
+
+
+// transaction takes 5 ms (clock stretching), then waits 30 ms.
+uint8_t stretchRuns = 0;
+
+uint16_t stretchJob(void * context)
+{
+  (void) context;
+  GODMODE()->micros += 5000;
+  stretchRuns++;
+  return (stretchRuns < 3) ? 30 : 0;
+}
+
+
+// slow device like AGS02MA, write register, wait 30 ms, read.
+// the 30 ms after the read is guarded by the 100 ms poll interval.
+struct slowDevice
+{
+  uint8_t address;
+  uint8_t state;
+  uint8_t reads;
+};
+
+uint16_t slowJob(void * context)
+{
+  slowDevice * dev = (slowDevice *) context;
+  if (dev->state == 0)
+  {
+    Wire.beginTransmission(dev->address);
+    Wire.write(0x00);
+    Wire.endTransmission();
+    dev->state = 1;
+    return 30;
+  }
+  if (dev->state == 1)
+  {
+    Wire.requestFrom(dev->address, (uint8_t)5);
+    dev->reads++;
+  }
+  dev->state = 0;
+  return 0;
+}
+
+
+unittest_setup()
+{
+}
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_constructor)
+{
+  fprintf(stderr, "VERSION: %s\n", (char *) I2CBUSMANAGER_LIB_VERSION);
+
+  I2CBusManager BM;
+  assertEqual(0, BM.deviceCount());
+  assertEqual(0, BM.jobCount());
+  assertEqual(0, BM.getClock());
+  assertEqual(100000, BM.getDefaultSpeed());
+  assertEqual(0, BM.getClockSwitches());
+  assertEqual(0, BM.getJobSteps());
+}
+
+
+unittest(test_devices)
+{
+  I2CBusManager BM;
+  assertTrue(BM.addDevice(0x1A, 30000));
+  assertTrue(BM.addDevice(0x20, 400000));
+  assertEqual(2, BM.deviceCount());
+  assertEqual(30000, BM.getMaxSpeed(0x1A));
+  assertEqual(400000, BM.getMaxSpeed(0x20));
+  assertEqual(100000, BM.getMaxSpeed(0x50));
+
+  // update
+  assertTrue(BM.addDevice(0x20, 1000000));
+  assertEqual(2, BM.deviceCount());
+  assertEqual(1000000, BM.getMaxSpeed(0x20));
+
+  BM.setDefaultSpeed(50000);
+  assertEqual(50000, BM.getMaxSpeed(0x50));
+
+  for (int i = 0; i < I2CBUSMANAGER_MAX_DEVICES - 2; i++)
+  {
+    assertTrue(BM.addDevice(0x30 + i, 100000));
+  }
+  assertFalse(BM.addDevice(0x40, 100000));
+}
+
+
+unittest(test_select)
+{
+  I2CBusManager BM;
+  BM.addDevice(0x1A, 30000);
+  BM.addDevice(0x20, 400000);
+  BM.addDevice(0x21, 400000);
+
+  BM.select(0x20);
+  assertEqual(400000, BM.getClock());
+  BM.select(0x21);
+  BM.select(0x20);
+  assertEqual(1, BM.getClockSwitches());
+  BM.select(0x1A);
+  assertEqual(30000, BM.getClock());
+  assertEqual(2, BM.getClockSwitches());
+}
+
+
+unittest(test_scheduled_wait)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.begin();
+
+  I2CBusManager BM;
+  BM.addDevice(0x1A, 30000);
+
+  slowDevice dev = { 0x1A, 0, 0 };
+  assertTrue(BM.addJob(0x1A, slowJob, &dev));
+  assertEqual(1, BM.run());
+  assertEqual(1, dev.state);
+  assertEqual(0, BM.run());      // waiting, no delay()
+  state->micros += 29000;
+  assertEqual(0, BM.run());
+  state->micros += 1000;
+  assertEqual(1, BM.run());
+  assertEqual(1, dev.reads);
+  assertEqual(0, BM.jobCount());
+  assertEqual(1, BM.getClockSwitches());
+}
+
+
+// the wait counts from the end of the job, not from the run() call.
+unittest(test_wait_after_job)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.begin();
+
+  I2CBusManager BM;
+  BM.addDevice(0x1A, 30000);
+
+  stretchRuns = 0;
+  assertTrue(BM.addJob(0x1A, stretchJob, NULL));
+  assertEqual(1, BM.run());
+  assertEqual(1, stretchRuns);
+  for (int i = 0; i < 30; i++)      // 0 .. 29 ms after the job
+  {
+    assertEqual(0, BM.run());
+    state->micros += 1000;
+  }
+  assertEqual(1, stretchRuns);
+  assertEqual(1, BM.run());
+  assertEqual(2, stretchRuns);
+  assertEqual(0, BM.run());
+  state->micros += 30000;
+  assertEqual(1, BM.run());
+  assertEqual(3, stretchRuns);
+  assertEqual(0, BM.jobCount());
+}
+
+
+// two slow sensors and two fast sensors, polled during one second.
+// blocking code switches the clock 4x per slow read and stalls the
+// fast devices 60 ms per slow read.
+unittest(test_mixed_bus)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.begin();
+
+  I2CBusManager BM;
+  BM.addDevice(0x1A, 30000);
+  BM.addDevice(0x1B, 30000);
+  BM.addDevice(0x20, 400000);
+  BM.addDevice(0x21, 400000);
+
+  uint8_t fast[2] = { 0x20, 0x21 };
+  slowDevice slow[2] = { { 0x1A, 0, 0 }, { 0x1B, 0, 0 } };
+  fastReads = 0;
+
+  for (uint32_t t = 0; t < 1000; t++)
+  {
+    state->micros = t * 1000UL;
+    if ((t % 10) == 0)
+    {
+      BM.addJob(fast[0], fastJob, &fast[0]);
+      BM.addJob(fast[1], fastJob, &fast[1]);
+    }
+    if ((t % 100) == 0)
+    {
+      BM.addJob(slow[0].address, slowJob, &slow[0]);
+      BM.addJob(slow[1].address, slowJob, &slow[1]);
+    }
+    BM.run();
+  }
+
+  uint32_t naiveSwitches = 4 * (slow[0].reads + slow[1].reads);
+  fprintf(stderr, "fast reads:\t%d\n", (int)fastReads);
+  fprintf(stderr, "slow reads:\t%d\n", slow[0].reads + slow[1].reads);
+  fprintf(stderr, "job steps:\t%d\n", (int)BM.getJobSteps());
+  fprintf(stderr, "switches:\t%d\t(blocking: %d)\n", (int)BM.getClockSwitches(), (int)naiveSwitches);
+
+  assertEqual(200, fastReads);
+  assertEqual(10, slow[0].reads);
+  assertEqual(10, slow[1].reads);
+  // both slow devices share the switches
+  assertLessOrEqual(BM.getClockSwitches(), naiveSwitches / 2 + 1);
+}
+
+
+unittest_main()
+
+// --------
@@ -0,0 +1,389 @@
+#pragma once
+//
+//    FILE: Kalman.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-11
+// PURPOSE: Arduino library for Kalman filters, fixed size, no dynamic memory
+//     URL: https://github.com/RobTillaart/Kalman
+//
+//  HISTORY:
+//  0.1.0   2021-09-11  initial version
+
+
+#include "Arduino.h"
+
+
+#define KALMAN_LIB_VERSION                (F("0.1.0"))
+
+#ifndef KALMAN_INITIAL_COVARIANCE
+#define KALMAN_INITIAL_COVARIANCE         1000.0
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// KALMAN - N states, M measurements
+//
+// x = F x                  P = F P Ft + Q         predict
+// S = H P Ht + R           K = P Ht S^-1          update
+// x = x + K (z - H x)      P = P - K H P
+//
+// all matrices are fixed size, the loop bounds are compile time constants
+// so the compiler can unroll them.
+//
+template <uint8_t N, uint8_t M>
+class Kalman
+{
+public:
+  Kalman()
+  {
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t c = 0; c < N; c++)
+      {
+        _F[r][c] = (r == c) ? 1 : 0;
+        _Q[r][c] = 0;
+      }
+      for (uint8_t m = 0; m < M; m++) _H[m][r] = 0;
+    }
+    setMeasurementNoise(1.0);
+    reset();
+  };
+
+
+  // state = 0, covariance = KALMAN_INITIAL_COVARIANCE
+  void reset()
+  {
+    for (uint8_t r = 0; r < N; r++)
+    {
+      _x[r] = 0;
+      for (uint8_t c = 0; c < N; c++)
+      {
+        _P[r][c] = (r == c) ? KALMAN_INITIAL_COVARIANCE : 0;
+      }
+    }
+  };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // MODEL, arrays are row major
+  //
+  // F  N x N, default identity
+  void setTransition(const float * F)
+  {
+    for (uint8_t r = 0; r < N; r++)
+      for (uint8_t c = 0; c < N; c++) _F[r][c] = F[r * N + c];
+  };
+  // e.g. to update dt
+  void setTransition(uint8_t row, uint8_t col, float value)  { _F[row][col] = value; };
+  float getTransition(uint8_t row, uint8_t col)              { return _F[row][col]; };
+
+  // H  M x N, default 0
+  void setMeasurement(const float * H)
+  {
+    for (uint8_t r = 0; r < M; r++)
+      for (uint8_t c = 0; c < N; c++) _H[r][c] = H[r * N + c];
+  };
+  void setMeasurement(uint8_t row, uint8_t col, float value)  { _H[row][col] = value; };
+
+  // Q  N x N, default 0
+  void setProcessNoise(const float * Q)
+  {
+    for (uint8_t r = 0; r < N; r++)
+      for (uint8_t c = 0; c < N; c++) _Q[r][c] = Q[r * N + c];
+  };
+  // diagonal only
+  void setProcessNoise(float q)
+  {
+    for (uint8_t r = 0; r < N; r++)
+      for (uint8_t c = 0; c < N; c++) _Q[r][c] = (r == c) ? q : 0;
+  };
+
+  // R  M x M, default identity
+  void setMeasurementNoise(const float * R)
+  {
+    for (uint8_t r = 0; r < M; r++)
+      for (uint8_t c = 0; c < M; c++) _R[r][c] = R[r * M + c];
+  };
+  // diagonal only, variance of the sensor(s)
+  void setMeasurementNoise(float r)
+  {
+    for (uint8_t i = 0; i < M; i++)
+      for (uint8_t c = 0; c < M; c++) _R[i][c] = (i == c) ? r : 0;
+  };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // STATE
+  //
+  void  setState(uint8_t i, float value)          { _x[i] = value; };
+  float getState(uint8_t i)                       { return _x[i]; };
+  // diagonal only
+  void  setCovariance(float p)
+  {
+    for (uint8_t r = 0; r < N; r++)
+      for (uint8_t c = 0; c < N; c++) _P[r][c] = (r == c) ? p : 0;
+  };
+  float getCovariance(uint8_t row, uint8_t col)   { return _P[row][col]; };
+  uint8_t states()                                { return N; };
+  uint8_t measurements()                          { return M; };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // FILTER
+  //
+  void predict()
+  {
+    float t[N];
+    for (uint8_t r = 0; r < N; r++)
+    {
+      float s = 0;
+      for (uint8_t c = 0; c < N; c++) s += _F[r][c] * _x[c];
+      t[r] = s;
+    }
+    for (uint8_t r = 0; r < N; r++) _x[r] = t[r];
+
+    // FP = F P,  P = FP Ft + Q
+    float FP[N][N];
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t c = 0; c < N; c++)
+      {
+        float s = 0;
+        for (uint8_t k = 0; k < N; k++) s += _F[r][k] * _P[k][c];
+        FP[r][c] = s;
+      }
+    }
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t c = 0; c < N; c++)
+      {
+        float s = _Q[r][c];
+        for (uint8_t k = 0; k < N; k++) s += FP[r][k] * _F[c][k];
+        _P[r][c] = s;
+      }
+    }
+  };
+
+
+  // returns false if S is singular, state is not changed then.
+  bool update(const float * z)
+  {
+    // PHt = P Ht   N x M
+    float PHt[N][M];
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t m = 0; m < M; m++)
+      {
+        float s = 0;
+        for (uint8_t k = 0; k < N; k++) s += _P[r][k] * _H[m][k];
+        PHt[r][m] = s;
+      }
+    }
+
+    // S = H PHt + R   M x M
+    float S[M][M];
+    for (uint8_t r = 0; r < M; r++)
+    {
+      for (uint8_t c = 0; c < M; c++)
+      {
+        float s = _R[r][c];
+        for (uint8_t k = 0; k < N; k++) s += _H[r][k] * PHt[k][c];
+        S[r][c] = s;
+      }
+    }
+    float Si[M][M];
+    if (_invert(S, Si) == false) return false;
+
+    // innovation y = z - H x
+    float y[M];
+    for (uint8_t m = 0; m < M; m++)
+    {
+      float s = z[m];
+      for (uint8_t k = 0; k < N; k++) s -= _H[m][k] * _x[k];
+      y[m] = s;
+    }
+
+    // K = PHt Si   N x M
+    float K[N][M];
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t c = 0; c < M; c++)
+      {
+        float s = 0;
+        for (uint8_t k = 0; k < M; k++) s += PHt[r][k] * Si[k][c];
+        K[r][c] = s;
+      }
+    }
+
+    // x = x + K y
+    for (uint8_t r = 0; r < N; r++)
+    {
+      float s = _x[r];
+      for (uint8_t m = 0; m < M; m++) s += K[r][m] * y[m];
+      _x[r] = s;
+    }
+
+    // P = P - K H P,  H P == PHt transposed as P is symmetric.
+    for (uint8_t r = 0; r < N; r++)
+    {
+      for (uint8_t c = 0; c < N; c++)
+      {
+        float s = _P[r][c];
+        for (uint8_t m = 0; m < M; m++) s -= K[r][m] * PHt[c][m];
+        _P[r][c] = s;
+      }
+    }
+    return true;
+  };
+
+
+  // single measurement
+  bool update(float z)
+  {
+    return update(&z);
+  };
+
+
+private:
+  // Gauss Jordan with partial pivoting, direct for M == 1.
+  bool _invert(float A[M][M], float B[M][M])
+  {
+    if (M == 1)
+    {
+      if (A[0][0] == 0) return false;
+      B[0][0] = 1.0 / A[0][0];
+      return true;
+    }
+    for (uint8_t r = 0; r < M; r++)
+      for (uint8_t c = 0; c < M; c++) B[r][c] = (r == c) ? 1 : 0;
+
+    for (uint8_t c = 0; c < M; c++)
+    {
+      uint8_t pivot = c;
+      for (uint8_t r = c + 1; r < M; r++)
+      {
+        if (fabs(A[r][c]) > fabs(A[pivot][c])) pivot = r;
+      }
+      if (A[pivot][c] == 0) return false;
+      if (pivot != c)
+      {
+        for (uint8_t k = 0; k < M; k++)
+        {
+          float t = A[c][k]; A[c][k] = A[pivot][k]; A[pivot][k] = t;
+          t = B[c][k]; B[c][k] = B[pivot][k]; B[pivot][k] = t;
+        }
+      }
+      float f = 1.0 / A[c][c];
+      for (uint8_t k = 0; k < M; k++)
+      {
+        A[c][k] *= f;
+        B[c][k] *= f;
+      }
+      for (uint8_t r = 0; r < M; r++)
+      {
+        if (r == c) continue;
+        float g = A[r][c];
+        for (uint8_t k = 0; k < M; k++)
+        {
+          A[r][k] -= g * A[c][k];
+          B[r][k] -= g * B[c][k];
+        }
+      }
+    }
+    return true;
+  };
+
+  float _x[N];
+  float _P[N][N];
+  float _F[N][N];
+  float _Q[N][N];
+  float _H[M][N];
+  float _R[M][M];
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// KALMANBANK - CH independent scalar filters, random walk model
+//
+// struct of arrays, so updating all channels is one tight loop.
+//
+template <uint8_t CH>
+class KalmanBank
+{
+public:
+  KalmanBank()
+  {
+    setProcessNoise(0.01);
+    setMeasurementNoise(1.0);
+    reset();
+  };
+
+
+  void reset()
+  {
+    for (uint8_t i = 0; i < CH; i++)
+    {
+      _x[i] = 0;
+      _p[i] = KALMAN_INITIAL_COVARIANCE;
+    }
+  };
+  void reset(uint8_t ch, float value = 0, float variance = KALMAN_INITIAL_COVARIANCE)
+  {
+    _x[ch] = value;
+    _p[ch] = variance;
+  };
+
+
+  // q = how much the signal may change per update (variance)
+  void  setProcessNoise(float q)              { for (uint8_t i = 0; i < CH; i++) _q[i] = q; };
+  void  setProcessNoise(uint8_t ch, float q)  { _q[ch] = q; };
+  float getProcessNoise(uint8_t ch)           { return _q[ch]; };
+  // r = variance of the sensor
+  void  setMeasurementNoise(float r)              { for (uint8_t i = 0; i < CH; i++) _r[i] = r; };
+  void  setMeasurementNoise(uint8_t ch, float r)  { _r[ch] = r; };
+  float getMeasurementNoise(uint8_t ch)           { return _r[ch]; };
+
+
+  float update(uint8_t ch, float z)
+  {
+    float p = _p[ch] + _q[ch];
+    float k = p / (p + _r[ch]);
+    _x[ch] += k * (z - _x[ch]);
+    _p[ch] = (1 - k) * p;
+    return _x[ch];
+  };
+
+
+  // z[CH], one measurement per channel
+  void update(const float * z)
+  {
+    for (uint8_t i = 0; i < CH; i++)
+    {
+      float p = _p[i] + _q[i];
+      float k = p / (p + _r[i]);
+      _x[i] += k * (z[i] - _x[i]);
+      _p[i] = (1 - k) * p;
+    }
+  };
+
+
+  float   get(uint8_t ch)          { return _x[ch]; };
+  float   getVariance(uint8_t ch)  { return _p[ch]; };
+  uint8_t channels()               { return CH; };
+
+
+private:
+  float _x[CH];
+  float _p[CH];
+  float _q[CH];
+  float _r[CH];
+};
+
+
+// -- END OF FILE --
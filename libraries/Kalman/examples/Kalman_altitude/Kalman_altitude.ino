@@ -0,0 +1,73 @@
+//
+//    FILE: Kalman_altitude.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: altitude and vertical speed from a MS5611 pressure sensor
+//    DATE: 2021-09-11
+//     URL: https://github.com/RobTillaart/Kalman
+//
+// needs https://github.com/RobTillaart/MS5611
+
+
+#include "Kalman.h"
+#include "MS5611.h"
+
+
+MS5611 MS(0x77);
+
+// state = altitude, vertical speed
+Kalman<2, 1> KF;
+
+uint32_t lastTime = 0;
+float    seaLevel = 1013.25;
+
+
+float altitude(float pressure)
+{
+  return 44330.0 * (1.0 - pow(pressure / seaLevel, 0.1903));
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("KALMAN_LIB_VERSION: ");
+  Serial.println(KALMAN_LIB_VERSION);
+
+  Wire.begin();
+  if (MS.begin() == false)
+  {
+    Serial.println("MS5611 not found");
+  }
+
+  KF.setMeasurement(0, 0, 1);     //  only altitude is measured
+  KF.setMeasurementNoise(0.25);   //  ~ 0.5 meter noise
+  float Q[4] = { 0.0001, 0, 0, 0.01 };
+  KF.setProcessNoise(Q);
+
+  MS.read();
+  KF.setState(0, altitude(MS.getPressure()));
+  lastTime = millis();
+}
+
+
+void loop()
+{
+  if (MS.read() != MS5611_READ_OK) return;
+
+  uint32_t now = millis();
+  float dt = (now - lastTime) * 0.001;
+  lastTime = now;
+
+  KF.setTransition(0, 1, dt);     //  altitude += speed * dt
+  KF.predict();
+  KF.update(altitude(MS.getPressure()));
+
+  Serial.print(KF.getState(0), 2);
+  Serial.print("\t");
+  Serial.println(KF.getState(1), 2);
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,151 @@
+//
+//    FILE: Kalman_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: updates per second and step response compared to RunningAverage
+//    DATE: 2021-09-11
+//     URL: https://github.com/RobTillaart/Kalman
+//
+// needs https://github.com/RobTillaart/RunningAverage
+//
+// the trace is a simulated HX711 weight step, 0 => 500 gram with noise.
+
+
+#include "Kalman.h"
+#include "RunningAverage.h"
+
+
+Kalman<1, 1>  KF1;
+Kalman<2, 1>  KF2;
+Kalman<3, 1>  KF3;
+KalmanBank<8> bank;
+RunningAverage RA(16);
+
+uint32_t start, stop;
+volatile float x;
+float z[8];
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("KALMAN_LIB_VERSION: ");
+  Serial.println(KALMAN_LIB_VERSION);
+  Serial.println();
+
+  KF1.setMeasurement(0, 0, 1);
+  KF2.setMeasurement(0, 0, 1);
+  KF2.setTransition(0, 1, 0.01);
+  KF3.setMeasurement(0, 0, 1);
+  KF3.setTransition(0, 1, 0.01);
+  KF3.setTransition(1, 2, 0.01);
+
+  Serial.println("FILTER\t\tUS\tUPDATES/SEC");
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    RA.addValue(i);
+    x = RA.getAverage();
+  }
+  stop = micros();
+  report("RunningAverage", stop - start, 1000);
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    KF1.predict();
+    KF1.update(i);
+  }
+  stop = micros();
+  report("Kalman<1,1>", stop - start, 1000);
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    KF2.predict();
+    KF2.update(i);
+  }
+  stop = micros();
+  report("Kalman<2,1>", stop - start, 1000);
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    KF3.predict();
+    KF3.update(i);
+  }
+  stop = micros();
+  report("Kalman<3,1>", stop - start, 1000);
+
+  start = micros();
+  for (int i = 0; i < 125; i++)
+  {
+    for (int ch = 0; ch < 8; ch++) z[ch] = i + ch;
+    bank.update(z);
+  }
+  stop = micros();
+  report("KalmanBank<8>", stop - start, 1000);
+
+  Serial.println();
+  stepResponse();
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+void report(const char * name, uint32_t duration, uint32_t count)
+{
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(duration);
+  Serial.print("\t");
+  Serial.println(count * 1e6 / duration, 0);
+  delay(100);
+}
+
+
+// samples needed to reach 90% of the step and the noise after settling.
+void stepResponse()
+{
+  KalmanBank<1> weight;
+  weight.setMeasurementNoise(4.0);    //  sensor variance, gram^2
+  weight.setProcessNoise(0.5);
+  RA.clear();
+  randomSeed(42);
+
+  int latencyRA = -1, latencyKF = -1;
+  float noiseRA = 0, noiseKF = 0;
+  for (int i = 0; i < 200; i++)
+  {
+    float truth = (i < 50) ? 0 : 500;
+    float z = truth + (random(2001) - 1000) * 0.0035;   //  ~ +- 3.5 gram
+    RA.addValue(z);
+    float ra = RA.getAverage();
+    float kf = weight.update(0, z);
+    if ((i >= 50) && (latencyRA < 0) && (ra > 450)) latencyRA = i - 50;
+    if ((i >= 50) && (latencyKF < 0) && (kf > 450)) latencyKF = i - 50;
+    if (i >= 100)
+    {
+      noiseRA += sq(ra - truth);
+      noiseKF += sq(kf - truth);
+    }
+  }
+  Serial.println("STEP\t\tLATENCY\tRMS ERROR");
+  Serial.print("RunningAverage\t");
+  Serial.print(latencyRA);
+  Serial.print("\t");
+  Serial.println(sqrt(noiseRA / 100), 3);
+  Serial.print("KalmanBank\t");
+  Serial.print(latencyKF);
+  Serial.print("\t");
+  Serial.println(sqrt(noiseKF / 100), 3);
+}
+
+
+// -- END OF FILE --
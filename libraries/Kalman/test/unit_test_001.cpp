@@ -0,0 +1,205 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-11
+// PURPOSE: unit tests for the Kalman library
+//          https://github.com/RobTillaart/Kalman
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+
+
+#include <ArduinoUnitTests.h>
+
+#include "Arduino.h"
+#include "Kalman.h"
+
+
+// uniform noise -1 .. 1, variance 1/3
+uint32_t seed = 1;
+float noise()
+{
+  seed = seed * 1664525UL + 1013904223UL;
+  return (seed >> 8) * (2.0 / 16777216.0) - 1.0;
+}
+
+
+unittest_setup()
+{
+  seed = 1;
+}
+
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_constructor)
+{
+  fprintf(stderr, "KALMAN_LIB_VERSION: %s\n", (char *) KALMAN_LIB_VERSION);
+
+  Kalman<2, 1> KF;
+  assertEqual(2, KF.states());
+  assertEqual(1, KF.measurements());
+  assertEqualFloat(0, KF.getState(0), 0.0001);
+  assertEqualFloat(KALMAN_INITIAL_COVARIANCE, KF.getCovariance(1, 1), 0.0001);
+  assertEqualFloat(1, KF.getTransition(0, 0), 0.0001);
+  assertEqualFloat(0, KF.getTransition(0, 1), 0.0001);
+
+  KalmanBank<8> bank;
+  assertEqual(8, bank.channels());
+  assertEqualFloat(0.01, bank.getProcessNoise(3), 0.0001);
+  assertEqualFloat(1.0,  bank.getMeasurementNoise(3), 0.0001);
+}
+
+
+unittest(test_scalar_equivalence)
+{
+  // Kalman<1,1> with F = 1, H = 1 == KalmanBank
+  Kalman<1, 1> KF;
+  KF.setMeasurement(0, 0, 1);
+  KF.setProcessNoise(0.05);
+  KF.setMeasurementNoise(2.0);
+
+  KalmanBank<4> bank;
+  bank.setProcessNoise(2, 0.05);
+  bank.setMeasurementNoise(2, 2.0);
+
+  for (int i = 0; i < 50; i++)
+  {
+    float z = 5 + noise();
+    KF.predict();
+    assertTrue(KF.update(z));
+    assertEqualFloat(KF.getState(0), bank.update(2, z), 0.0001);
+  }
+  assertEqualFloat(KF.getCovariance(0, 0), bank.getVariance(2), 0.0001);
+  assertEqualFloat(5, KF.getState(0), 0.3);
+}
+
+
+unittest(test_constant_velocity)
+{
+  // altitude = 10 + 2 t, measured with noise, estimate the speed.
+  float dt = 0.1;
+  float F[4] = { 1, dt, 0, 1 };
+  Kalman<2, 1> KF;
+  KF.setTransition(F);
+  KF.setMeasurement(0, 0, 1);
+  KF.setProcessNoise(0.0001);
+  KF.setMeasurementNoise(0.33);
+
+  for (int i = 0; i < 500; i++)
+  {
+    float t = i * dt;
+    KF.predict();
+    KF.update(10 + 2 * t + noise());
+  }
+  assertEqualFloat(2.0, KF.getState(1), 0.1);
+  assertEqualFloat(10 + 2 * 49.9, KF.getState(0), 0.2);
+}
+
+
+unittest(test_two_sensors)
+{
+  // one state measured by two sensors, the accurate one dominates.
+  Kalman<1, 2> KF;
+  float H[2] = { 1, 1 };
+  float R[4] = { 100, 0, 0, 0.01 };
+  KF.setMeasurement(H);
+  KF.setMeasurementNoise(R);
+
+  float z[2] = { 20, 10 };
+  KF.predict();
+  assertTrue(KF.update(z));
+  assertEqualFloat(10.0, KF.getState(0), 0.01);
+
+  // singular S
+  Kalman<1, 2> KF2;
+  float R2[4] = { 1, 1, 1, 1 };
+  KF2.setMeasurement(H);
+  KF2.setMeasurementNoise(R2);
+  KF2.setCovariance(0);
+  assertFalse(KF2.update(z));
+}
+
+
+unittest(test_bank_all)
+{
+  KalmanBank<16> bank;
+  bank.setMeasurementNoise(0.33);
+  bank.setProcessNoise(0.0);
+  float z[16];
+  for (int n = 0; n < 200; n++)
+  {
+    for (int i = 0; i < 16; i++) z[i] = i * 10 + noise();
+    bank.update(z);
+  }
+  for (int i = 0; i < 16; i++)
+  {
+    assertEqualFloat(i * 10, bank.get(i), 0.15);
+  }
+  bank.reset(3, 42);
+  assertEqualFloat(42, bank.get(3), 0.0001);
+}
+
+
+unittest(test_ramp_lag)
+{
+  // on a ramp a moving average lags (N - 1) / 2 samples,
+  // a constant velocity Kalman filter does not.
+  float F[4] = { 1, 1, 0, 1 };
+  Kalman<2, 1> KF;
+  KF.setTransition(F);
+  KF.setMeasurement(0, 0, 1);
+  KF.setProcessNoise(0.0001);
+  KF.setMeasurementNoise(0.33);
+
+  float buf[16] = { 0 };
+  float sum = 0;
+  float errKF = 0, errMA = 0;
+  for (int i = 0; i < 400; i++)
+  {
+    float truth = 0.5 * i;
+    float z = truth + noise();
+    KF.predict();
+    KF.update(z);
+    sum += z - buf[i & 15];
+    buf[i & 15] = z;
+    if (i >= 200)
+    {
+      errKF += fabs(KF.getState(0) - truth);
+      errMA += fabs(sum / 16 - truth);
+    }
+  }
+  fprintf(stderr, "mean abs error  KF: %f  MA16: %f\n", errKF / 200, errMA / 200);
+  assertEqualFloat(3.75, errMA / 200, 0.1);
+  assertMore(0.3, errKF / 200);
+}
+
+
+unittest_main()
+
+// --------
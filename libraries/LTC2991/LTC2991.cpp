@@ -1,7 +1,7 @@
 //
 //    FILE: LTC2991.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 //    DATE: 2021-05-10
 // PURPOSE: Library for LTC2991 temperature and voltage control IC
 //     URL: https://github.com/RobTillaart/LTC2991
@@ -10,6 +10,8 @@
 //  0.1.0   2021-05-10  initial version
 //  0.1.1   2021-05-16  add trigger_conversion(), set_PWM_fast() 
 //          performance optimizations, some default values, and cleanup.
+//  0.1.2   2021-06-01  shadow control registers, readAll() in one burst,
+//                      fix get_PWM() LSB and _clrRegisterMask() test.
 
 
 #include "LTC2991.h"
@@ -71,6 +73,7 @@ LTC2991::LTC2991(const int8_t address, TwoWire *wire)
 {
   _address = address;
   _wire = wire;
+  for (uint8_t i = 0; i < 4; i++) _shadow[i] = 0;
 }
 
 
@@ -80,7 +83,7 @@ bool LTC2991::begin(const uint8_t sda, const uint8_t scl)
   _wire = &Wire;
   _wire->begin(sda, scl);
   if (! isConnected()) return false;
-  return true;
+  return _loadShadow();
 }
 #endif
 
@@ -89,7 +92,7 @@ bool LTC2991::begin()
 {
   _wire->begin();
   if (! isConnected()) return false;
-  return true;
+  return _loadShadow();
 }
 
 
@@ -311,47 +314,33 @@ uint8_t LTC2991::get_differential_mode(uint8_t n)
 
 float LTC2991::get_value(uint8_t channel)
 {
-  uint8_t chan = channel - 1;
-  uint8_t pair = (channel + 1)/2;
-  int16_t v = _readRegister16(V_BASE + chan * 2);
+  int16_t v = _readRegister16(V_BASE + (channel - 1) * 2);
+  return _convertValue(channel, v);
+}
 
-  if (get_operational_mode(pair) > 0)  // temperature
-  {
-    if (get_temp_scale(pair) == 'K')   // KELVIN
-    {
-      return TEMPERATURE_FACTOR * (float)v;
-    }
-    // CELSIUS positive
-    if ((v & 0x1000) == 0)
-    {
-      return TEMPERATURE_FACTOR * (float)v;
-    }
-    // CELSIUS neg two complements  (page 13, 2nd colom.)
-    v = (v^0x1FFF) + 1;
-    return TEMPERATURE_FACTOR * (float)v * -1.0;
-  }
 
-  if (get_differential_mode(pair) == 0)  // SINGLE ENDED
-  {
-    if ((v & 0x4000) == 0)
-    {
-      return SINGLE_ENDED_FACTOR * (float)v;
-    }
-    v = (v^0x7FFFF) + 1;
-    return SINGLE_ENDED_FACTOR * (float)v * -1.0;
-  }
-  // DIFFERENTIAL
-  if ((v & 0x4000) == 0)
+uint16_t LTC2991::readAll(float values[LTC2991_READALL_SIZE], bool onlyNew)
+{
+  // V1_MSB .. VCC_LSB == 20 bytes, fits in the Wire buffer.
+  uint8_t buffer[20];
+  if (_readBlock(V1_MSB, buffer, 20) != 20) return 0;
+
+  uint16_t mask = 0;
+  for (uint8_t i = 0; i < LTC2991_READALL_SIZE; i++)
   {
-    return DIFFERENTIAL_FACTOR * (float)v;
+    uint16_t x = (buffer[i * 2] << 8) | buffer[i * 2 + 1];
+    bool dataValid = (x & 0x8000) > 0;
+    if (dataValid) mask |= (1 << i);
+    else if (onlyNew) continue;
+    x &= 0x7FFF;
+    if (i < 8)       values[i] = _convertValue(i + 1, x);
+    else if (i == 8) values[i] = _convertTintern(x);
+    else             values[i] = _convertVCC(x);
   }
-  v = (v^0x7FFFF) + 1;
-  return DIFFERENTIAL_FACTOR * (float)v * -1.0;
+  return mask;
 }
 
 
-
-
 //////////////////////////////////////////////////////////////////
 //
 // PWM functions
@@ -377,9 +366,9 @@ void LTC2991::set_PWM_fast(uint16_t value)
 
 uint16_t LTC2991::get_PWM()
 {
-  uint16_t pwm = _readRegister(PWM_THRESHOLD_MSB);
+  uint16_t pwm = _cachedRead(PWM_THRESHOLD_MSB);
   pwm <<= 1;
-  if (_readRegister(PWM_THRESHOLD_LSB) > 0 ) pwm |= 0x01;
+  if (_cachedRead(PWM_THRESHOLD_LSB) & 0x80) pwm |= 0x01;
   return pwm;
 }
 
@@ -485,32 +474,14 @@ char LTC2991::get_temp_scale_Tintern()
 float LTC2991::get_Tintern()
 {
   int16_t v = _readRegister16(T_INTERNAL_MSB);
-
-  if (get_temp_scale_Tintern() == 'K') 
-  {
-    return TEMPERATURE_FACTOR * (float)v;
-  }
-  // CELSIUS positive value
-  if ((v & 0x1000) == 0) 
-  {
-    return TEMPERATURE_FACTOR * (float)v;
-  }
-  // CELSIUS neg two complements  (page 13, 2nd colom.)
-  v = (v^0x1FFF) + 1;
-  return TEMPERATURE_FACTOR * (float)v * -1.0;
+  return _convertTintern(v);
 }
 
 
 float LTC2991::get_VCC()
 {
   int16_t v = _readRegister16(VCC_MSB);
-  if ((v & 0x4000) == 0)
-  {
-    return VCC_FACTOR * (float)v + 2.5;
-  }
-  // can Vcc be negative?
-  v = (v^0x7FFFF) + 1;
-  return VCC_FACTOR * (float)v * -1.0 + 2.5;
+  return _convertVCC(v);
 }
 
 
@@ -521,6 +492,10 @@ float LTC2991::get_VCC()
 //
 uint8_t LTC2991::_writeRegister(const uint8_t reg, const uint8_t value)
 {
+  if ((reg >= CONTROL_V1_V4) && (reg <= PWM_THRESHOLD_MSB))
+  {
+    _shadow[reg - CONTROL_V1_V4] = value;
+  }
   _wire->beginTransmission(_address);
   _wire->write(reg);
   _wire->write(value);
@@ -541,17 +516,54 @@ uint8_t LTC2991::_readRegister(const uint8_t reg)
 
 uint16_t LTC2991::_readRegister16(const uint8_t reg)
 {
-  uint16_t x = _readRegister(reg) << 8;
-  x |= _readRegister(reg + 1);
+  uint8_t buffer[2];
+  _readBlock(reg, buffer, 2);
+  uint16_t x = (buffer[0] << 8) | buffer[1];
   bool dataValid = (x & 0x8000) > 0;   // do nothing for now...
   x &= 0x7FFF;
   return x;
 }
 
 
+// uses the auto increment of the register pointer.
+uint8_t LTC2991::_readBlock(const uint8_t reg, uint8_t * buffer, const uint8_t length)
+{
+  _wire->beginTransmission(_address);
+  _wire->write(reg);
+  _wire->endTransmission();
+
+  uint8_t n = _wire->requestFrom(_address, length);
+  for (uint8_t i = 0; i < n; i++)
+  {
+    buffer[i] = _wire->read();
+  }
+  for (uint8_t i = n; i < length; i++)
+  {
+    buffer[i] = 0;
+  }
+  return n;
+}
+
+
+uint8_t LTC2991::_cachedRead(const uint8_t reg)
+{
+  if ((reg >= CONTROL_V1_V4) && (reg <= PWM_THRESHOLD_MSB))
+  {
+    return _shadow[reg - CONTROL_V1_V4];
+  }
+  return _readRegister(reg);
+}
+
+
+bool LTC2991::_loadShadow()
+{
+  return _readBlock(CONTROL_V1_V4, _shadow, 4) == 4;
+}
+
+
 void LTC2991::_setRegisterMask(const uint8_t reg, uint8_t mask)
 {
-  uint8_t x = _readRegister(reg);
+  uint8_t x = _cachedRead(reg);
   if ((x & mask) != mask)   // if not all bits set, set them
   {
     x |= mask;
@@ -562,8 +574,8 @@ void LTC2991::_setRegisterMask(const uint8_t reg, uint8_t mask)
 
 void LTC2991::_clrRegisterMask(const uint8_t reg, uint8_t mask)
 {
-  uint8_t x = _readRegister(reg);
-  if (x | mask)         // if any bit of the mask set clear it
+  uint8_t x = _cachedRead(reg);
+  if (x & mask)         // if any bit of the mask set clear it
   {
     x &= ~mask;
     _writeRegister(reg, x);
@@ -572,8 +584,77 @@ void LTC2991::_clrRegisterMask(const uint8_t reg, uint8_t mask)
 
 uint8_t LTC2991::_getRegisterMask(const uint8_t reg, uint8_t mask)
 {
-  uint8_t x = _readRegister(reg);
+  uint8_t x = _cachedRead(reg);
   return x & mask;
 }
 
+
+// uses shadowed modes, no I2C traffic.
+float LTC2991::_convertValue(uint8_t channel, int16_t v)
+{
+  uint8_t pair = (channel + 1)/2;
+
+  if (get_operational_mode(pair) > 0)  // temperature
+  {
+    if (get_temp_scale(pair) == 'K')   // KELVIN
+    {
+      return TEMPERATURE_FACTOR * (float)v;
+    }
+    // CELSIUS positive
+    if ((v & 0x1000) == 0)
+    {
+      return TEMPERATURE_FACTOR * (float)v;
+    }
+    // CELSIUS neg two complements  (page 13, 2nd colom.)
+    v = (v^0x1FFF) + 1;
+    return TEMPERATURE_FACTOR * (float)v * -1.0;
+  }
+
+  if (get_differential_mode(pair) == 0)  // SINGLE ENDED
+  {
+    if ((v & 0x4000) == 0)
+    {
+      return SINGLE_ENDED_FACTOR * (float)v;
+    }
+    v = (v^0x7FFFF) + 1;
+    return SINGLE_ENDED_FACTOR * (float)v * -1.0;
+  }
+  // DIFFERENTIAL
+  if ((v & 0x4000) == 0)
+  {
+    return DIFFERENTIAL_FACTOR * (float)v;
+  }
+  v = (v^0x7FFFF) + 1;
+  return DIFFERENTIAL_FACTOR * (float)v * -1.0;
+}
+
+
+float LTC2991::_convertTintern(int16_t v)
+{
+  if (get_temp_scale_Tintern() == 'K')
+  {
+    return TEMPERATURE_FACTOR * (float)v;
+  }
+  // CELSIUS positive value
+  if ((v & 0x1000) == 0)
+  {
+    return TEMPERATURE_FACTOR * (float)v;
+  }
+  // CELSIUS neg two complements  (page 13, 2nd colom.)
+  v = (v^0x1FFF) + 1;
+  return TEMPERATURE_FACTOR * (float)v * -1.0;
+}
+
+
+float LTC2991::_convertVCC(int16_t v)
+{
+  if ((v & 0x4000) == 0)
+  {
+    return VCC_FACTOR * (float)v + 2.5;
+  }
+  // can Vcc be negative?
+  v = (v^0x7FFFF) + 1;
+  return VCC_FACTOR * (float)v * -1.0 + 2.5;
+}
+
 // -- END OF FILE --
@@ -2,7 +2,7 @@
 //
 //    FILE: LTC2991.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 //    DATE: 2021-05-10
 // PURPOSE: Library for LTC2991 temperature and voltage control IC
 //     URL: https://github.com/RobTillaart/LTC2991
@@ -11,7 +11,10 @@
 #include "Arduino.h"
 #include "Wire.h"
 
-#define LTC2991_LIB_VERSION         (F("0.1.1"))
+#define LTC2991_LIB_VERSION         (F("0.1.2"))
+
+// V1..V8 + Tintern + VCC
+#define LTC2991_READALL_SIZE        10
 
 
 class LTC2991
@@ -61,6 +64,12 @@ public:
   uint8_t get_differential_mode(uint8_t n);
   float   get_value(uint8_t channel);      // chan = 1..8
 
+  // reads V1..V8, Tintern and VCC in one I2C burst.
+  // values[0..7] = V1..V8, values[8] = Tintern, values[9] = VCC
+  // returns bit mask of the values that were new (data valid bit set).
+  // onlyNew == true leaves values[] of stale channels untouched.
+  uint16_t readAll(float values[LTC2991_READALL_SIZE], bool onlyNew = false);
+
 
   //
   // PWM
@@ -103,6 +112,16 @@ private:
   uint8_t  _writeRegister(const uint8_t reg, const uint8_t value);
   uint8_t  _readRegister(const uint8_t reg);
   uint16_t _readRegister16(const uint8_t reg);
+  uint8_t  _readBlock(const uint8_t reg, uint8_t * buffer, const uint8_t length);
+
+  // CONTROL_V1_V4 .. PWM_THRESHOLD_MSB are only changed by the library
+  // so they are shadowed to prevent a read before every get/set.
+  uint8_t _cachedRead(const uint8_t reg);
+  bool    _loadShadow();
+
+  float   _convertValue(uint8_t channel, int16_t v);
+  float   _convertTintern(int16_t v);
+  float   _convertVCC(int16_t v);
 
 
   void    _setRegisterMask(const uint8_t reg, uint8_t mask);
@@ -111,6 +130,7 @@ private:
 
   uint8_t   _address;
   TwoWire * _wire;
+  uint8_t   _shadow[4];
 
 };
 
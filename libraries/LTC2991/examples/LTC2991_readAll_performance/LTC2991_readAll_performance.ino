@@ -0,0 +1,74 @@
+//
+//    FILE: LTC2991_readAll_performance.ino
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-06-01
+// PUPROSE: compare get_value() per channel with readAll()
+
+
+#include "Wire.h"
+#include "LTC2991.h"
+
+LTC2991 LTC(0x20);
+
+uint32_t start, stop;
+float values[LTC2991_READALL_SIZE];
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("LTC2991_LIB_VERSION:\t");
+  Serial.println(LTC2991_LIB_VERSION);
+
+  Wire.begin();
+  Wire.setClock(100000);
+  LTC.begin();
+  while (!LTC.isConnected())
+  {
+    Serial.println("Could not connect to device");
+    delay(2000);
+  }
+
+  LTC.set_acquisition_repeat();
+  LTC.trigger_conversion_all();
+  LTC.enable_Tintern_Vcc(true);
+  delay(100);
+
+  start = micros();
+  for (uint8_t ch = 1; ch <= 8; ch++)
+  {
+    values[ch - 1] = LTC.get_value(ch);
+  }
+  values[8] = LTC.get_Tintern();
+  values[9] = LTC.get_VCC();
+  stop = micros();
+  Serial.print("get_value() x10:\t");
+  Serial.println(stop - start);
+  delay(100);
+
+  start = micros();
+  uint16_t mask = LTC.readAll(values);
+  stop = micros();
+  Serial.print("readAll():\t\t");
+  Serial.println(stop - start);
+  Serial.print("new data mask:\t\t");
+  Serial.println(mask, BIN);
+  Serial.println();
+}
+
+
+void loop()
+{
+  uint16_t mask = LTC.readAll(values, true);
+  for (uint8_t i = 0; i < LTC2991_READALL_SIZE; i++)
+  {
+    Serial.print(values[i], 3);
+    Serial.print("\t");
+  }
+  Serial.println(mask, BIN);
+  delay(1000);
+}
+
+
+// -- END OF FILE --
@@ -55,6 +55,105 @@ unittest(test_constructor)
 }
 
 
+unittest(test_shadow_registers)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x20);
+  auto miso = Wire.getMiso(0x20);
+
+  LTC2991 LTC(0x20);
+  // CONTROL_V1_V4, CONTROL_V5_V8, PWM_THRESHOLD_LSB, PWM_THRESHOLD_MSB
+  miso->push_back(0x00);
+  miso->push_back(0x00);
+  miso->push_back(0x14);   // repeat + Kelvin Tintern
+  miso->push_back(0x00);
+  assertTrue(LTC.begin());
+  assertEqual(1, mosi->size());    // one register pointer write
+  assertEqual(0, miso->size());    // one burst read
+
+  // getters use the shadow, no I2C traffic
+  mosi->clear();
+  assertEqual(0, LTC.get_operational_mode(1));
+  assertEqual(0, LTC.get_differential_mode(3));
+  assertEqual('C', LTC.get_temp_scale(2));
+  assertEqual('K', LTC.get_temp_scale_Tintern());
+  assertEqual(1, LTC.get_acquisition_mode());
+  assertEqual(0, mosi->size());
+
+  // setters only write, one transaction of register + value
+  LTC.set_mode_temperature(1);
+  assertEqual(2, mosi->size());
+  assertEqual(1, LTC.get_operational_mode(1));
+  // already set, no write at all
+  LTC.set_mode_temperature(1);
+  assertEqual(2, mosi->size());
+  // Kelvin + temperature mode in one go as mode bit is set
+  LTC.set_Kelvin(1);
+  assertEqual(4, mosi->size());
+  assertEqual('K', LTC.get_temp_scale(1));
+}
+
+
+unittest(test_get_value_transactions)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x20);
+  auto miso = Wire.getMiso(0x20);
+
+  LTC2991 LTC(0x20);
+  for (int i = 0; i < 4; i++) miso->push_back(0x00);
+  assertTrue(LTC.begin());
+  mosi->clear();
+
+  // V1 single ended, 0x1000 => 1.25 V
+  miso->push_back(0x90);
+  miso->push_back(0x00);
+  assertEqualFloat(1.25, LTC.get_value(1), 0.001);
+  assertEqual(1, mosi->size());   // only register pointer
+  assertEqual(0, miso->size());   // 2 bytes, one request
+}
+
+
+unittest(test_readAll)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x20);
+  auto miso = Wire.getMiso(0x20);
+
+  LTC2991 LTC(0x20);
+  // pair 2 (V3 V4) in temperature mode Kelvin
+  miso->push_back(0x60);
+  miso->push_back(0x00);
+  miso->push_back(0x00);
+  miso->push_back(0x00);
+  assertTrue(LTC.begin());
+  mosi->clear();
+
+  // V1..V8 (V3 = T2), Tintern, VCC; V2 and V6 are stale
+  uint16_t raw[10] = { 0x9000, 0x0800, 0x8290, 0x8000, 0x8800, 0x0400, 0x8000, 0x8000, 0x8190, 0x8000 };
+  for (int i = 0; i < 10; i++)
+  {
+    miso->push_back(raw[i] >> 8);
+    miso->push_back(raw[i] & 0xFF);
+  }
+  float values[LTC2991_READALL_SIZE];
+  for (int i = 0; i < LTC2991_READALL_SIZE; i++) values[i] = -99;
+
+  uint16_t mask = LTC.readAll(values, true);
+  assertEqual(1, mosi->size());
+  assertEqual(0, miso->size());
+  assertEqual(0x03DD, mask);
+
+  assertEqualFloat(1.25, values[0], 0.001);
+  assertEqualFloat(-99, values[1], 0.001);     // stale, untouched
+  assertEqualFloat(41.0, values[2], 0.001);    // 0x290 / 16 Kelvin
+  assertEqualFloat(0.625, values[4], 0.001);
+  assertEqualFloat(-99, values[5], 0.001);
+  assertEqualFloat(25.0, values[8], 0.001);    // 0x190 / 16 Celsius
+  assertEqualFloat(2.5, values[9], 0.001);
+}
+
+
 unittest_main()
 
 // --------
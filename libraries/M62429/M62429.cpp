@@ -2,7 +2,7 @@
 //    FILE: M62429.cpp
 //  AUTHOR: Rob Tillaart
 // PURPOSE: Arduino library for M62429 volume control IC
-// VERSION: 0.2.2
+// VERSION: 0.2.3
 // HISTORY: See M62429.cpp2
 //     URL: https://github.com/RobTillaart/M62429
 
@@ -11,6 +11,8 @@
 //  0.2.0   2020-08-02  refactor
 //  0.2.1   2020-12-30  add arduino-ci + unit test
 //  0.2.2   2021-05-27  fix library.properties
+//  0.2.3   2021-09-06  add non blocking fade(), update()
+//                      precomputed frames, cached port for AVR
 
 
 #include "M62429.h"
@@ -25,6 +27,14 @@ void M62429::begin(uint8_t dataPin, uint8_t clockPin)
   digitalWrite(_data, LOW);
   digitalWrite(_clock, LOW);
 
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR)
+  _dataOut  = portOutputRegister(digitalPinToPort(_data));
+  _dataBit  = digitalPinToBitMask(_data);
+  _clockOut = portOutputRegister(digitalPinToPort(_clock));
+  _clockBit = digitalPinToBitMask(_clock);
+#endif
+
+  _fading[0] = _fading[1] = false;
   _muted = false;
   setVolume(2, 0);
 }
@@ -42,9 +52,8 @@ int M62429::setVolume(uint8_t channel, uint8_t volume)
   if (channel > 2) return M62429_CHANNEL_ERROR;
   if (_muted)      return M62429_MUTED;
 
-  uint8_t attn = volume/3 + 2;
-  if (attn <= 2) attn = 0;
-  _setVolume(channel, attn);
+  stopFade(channel);
+  _setVolume(channel, volume);
 
   // update cached values
   if (channel == 0) _vol[0] = volume;
@@ -82,6 +91,7 @@ void M62429::average()
 
 void M62429::muteOn()
 {
+  stopFade();
   _muted = true;
   setVolume(2, 0);
 }
@@ -95,21 +105,164 @@ void M62429::muteOff()
 }
 
 
+////////////////////////////////////////////////////////////////////
+//
+// FADE
+//
+int M62429::fade(uint8_t channel, uint8_t volume, uint32_t duration, uint8_t curve)
+{
+  if (channel > 2) return M62429_CHANNEL_ERROR;
+  if (_muted)      return M62429_MUTED;
+
+  uint32_t now = micros();
+  for (uint8_t ch = 0; ch < 2; ch++)
+  {
+    if ((channel != 2) && (channel != ch)) continue;
+    // precompute the volume and frame of every step
+    int16_t start = _vol[ch];
+    int16_t delta = (int16_t)volume - start;
+    for (uint8_t step = 0; step < M62429_FADE_STEPS; step++)
+    {
+      float t = (step + 1) * (1.0 / M62429_FADE_STEPS);
+      // LOG: fast at start, slow at the end, t = 0..1 => 0..1
+      if (curve == M62429_FADE_LOG) t = log10(1 + 9 * t);
+      uint8_t v = start + round(delta * t);
+      _fadeVolume[ch][step] = v;
+      _fadeFrame[ch][step]  = _frame(v);
+    }
+    _fadeVolume[ch][M62429_FADE_STEPS - 1] = volume;
+    _fadeFrame[ch][M62429_FADE_STEPS - 1]  = _frame(volume);
+    _fadeStep[ch]     = 0;
+    _fadeStart[ch]    = now;
+    _fadeDuration[ch] = duration * 1000UL;
+    _fading[ch]       = true;
+  }
+  return 0;
+}
+
+
+// writes the frame of the step that is due, skipping steps if called late.
+// if both channels need the same frame, it is written once for both.
+uint8_t M62429::update()
+{
+  if (!_fading[0] && !_fading[1]) return 0;
+
+  uint32_t now = micros();
+  bool due[2] = { false, false };
+  for (uint8_t ch = 0; ch < 2; ch++)
+  {
+    if (!_fading[ch]) continue;
+    uint32_t elapsed = now - _fadeStart[ch];
+    uint8_t step = M62429_FADE_STEPS;
+    if (elapsed < _fadeDuration[ch])
+    {
+      step = ((uint64_t)elapsed * M62429_FADE_STEPS) / _fadeDuration[ch];
+    }
+    if (step <= _fadeStep[ch]) continue;
+    _fadeStep[ch] = step;
+    _vol[ch] = _fadeVolume[ch][step - 1];
+    if (step == M62429_FADE_STEPS) _fading[ch] = false;
+    due[ch] = (_fadeFrame[ch][step - 1] != _lastFrame[ch]);
+  }
+
+  uint8_t frames = 0;
+  if (due[0] && due[1] && (_fadeFrame[0][_fadeStep[0] - 1] == _fadeFrame[1][_fadeStep[1] - 1]))
+  {
+    _lastFrame[0] = _lastFrame[1] = _fadeFrame[0][_fadeStep[0] - 1];
+    _writeFrame(_lastFrame[0]);  // channel bits 00 == both
+    return 1;
+  }
+  if (due[0])
+  {
+    _lastFrame[0] = _fadeFrame[0][_fadeStep[0] - 1];
+    _writeFrame(_lastFrame[0] | 0x03);
+    frames++;
+  }
+  if (due[1])
+  {
+    _lastFrame[1] = _fadeFrame[1][_fadeStep[1] - 1];
+    _writeFrame(_lastFrame[1] | 0x02);
+    frames++;
+  }
+  return frames;
+}
+
+
+bool M62429::isFading(uint8_t channel)
+{
+  if (channel == 0) return _fading[0];
+  if (channel == 1) return _fading[1];
+  return _fading[0] || _fading[1];
+}
+
+
+void M62429::stopFade(uint8_t channel)
+{
+  if (channel != 1) _fading[0] = false;
+  if (channel != 0) _fading[1] = false;
+}
+
+
 ////////////////////////////////////////////////////////////////////
 //
 // PRIVATE
 //
+void M62429::_setVolume(uint8_t channel, uint8_t volume)
+{
+  uint16_t databits = _frame(volume);
+  // channel == 2 -> both 0x00 is default
+  if (channel != 1) _lastFrame[0] = databits;
+  if (channel != 0) _lastFrame[1] = databits;
+  if (channel == 0) databits |= 0x03;   // 11
+  if (channel == 1) databits |= 0x02;   // 01
+  _writeFrame(databits);
+}
+
 
-// attn = 0, 3..87
-void M62429::_setVolume(uint8_t channel, uint8_t attn)
+// frame without the channel bits.
+uint16_t M62429::_frame(uint8_t volume)
 {
+  // attn = 0, 3..87
+  uint8_t attn = volume/3 + 2;
+  if (attn <= 2) attn = 0;
   uint16_t databits = 0xFE00;           // latch bits
   databits |= (attn & 0x007C);
   databits |= ((attn & 0x03) << 7);
-  // channel == 2 -> both 0x00 is default
-  if (channel == 0) databits |= 0x03;   // 11
-  if (channel == 1) databits |= 0x02;   // 01
+  return databits;
+}
+
 
+void M62429::_writeFrame(uint16_t databits)
+{
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR)
+  // cached port registers, the clock needs a delay now, 1.6 us minimum.
+  uint8_t dbmask1 = _dataBit;
+  uint8_t dbmask2 = ~_dataBit;
+  uint8_t cbmask1 = _clockBit;
+  uint8_t cbmask2 = ~_clockBit;
+  for (uint16_t mask = 1; mask < 0x0200; mask <<= 1)
+  {
+    uint8_t oldSREG = SREG;
+    noInterrupts();
+    if (databits & mask) *_dataOut |= dbmask1;
+    else                 *_dataOut &= dbmask2;
+    *_clockOut |= cbmask1;
+    SREG = oldSREG;
+    delayMicroseconds(2);
+    oldSREG = SREG;
+    noInterrupts();
+    *_dataOut  &= dbmask2;
+    *_clockOut &= cbmask2;
+    SREG = oldSREG;
+    delayMicroseconds(2);
+  }
+  // Last latch bit must be high
+  *_dataOut  |= dbmask1;
+  *_clockOut |= cbmask1;
+  delayMicroseconds(2);
+  *_clockOut &= cbmask2;
+  delayMicroseconds(2);
+#else
   for (uint16_t mask = 1; mask < 0x0200; mask <<= 1)
   {
     digitalWrite(_data, databits & mask);
@@ -129,6 +282,7 @@ void M62429::_setVolume(uint8_t channel, uint8_t attn)
   // _data is already high 
   digitalWrite(_clock, LOW);
   if (M62429_CLOCK_DELAY > 0) delayMicroseconds(M62429_CLOCK_DELAY);
+#endif
 }
 
 // -- END OF FILE --
@@ -3,7 +3,7 @@
 //    FILE: M62429.h
 //  AUTHOR: Rob Tillaart
 // PURPOSE: Arduino library for M62429 volume control IC
-// VERSION: 0.2.2
+// VERSION: 0.2.3
 //
 // HISTORY: See M62429.cpp
 //     URL: https://github.com/RobTillaart/M62429
@@ -12,7 +12,7 @@
 #include "Arduino.h"
 
 
-#define M62429_VERSION          (F("0.2.2"))
+#define M62429_VERSION          (F("0.2.3"))
 
 
 // minimum pulswidth CLOCK = 1.6 us (datasheet);
@@ -27,6 +27,16 @@
 #endif
 
 
+// number of precomputed steps per fade, uses 3 bytes per step per channel.
+#ifndef M62429_FADE_STEPS
+#define M62429_FADE_STEPS       32
+#endif
+
+// FADE CURVES
+#define M62429_FADE_LINEAR      0
+#define M62429_FADE_LOG         1
+
+
 // ERROR CODES
 #define M62429_MUTED            -1
 #define M62429_CHANNEL_ERROR    -10
@@ -51,13 +61,41 @@ public:
   void    muteOff();
   bool    isMuted()  { return _muted; };
 
+  // FADE - non blocking
+  // channel = { 0, 1, 2 = both }; duration in milliseconds
+  int     fade(uint8_t channel, uint8_t volume, uint32_t duration, uint8_t curve = M62429_FADE_LINEAR);
+  // call as often as possible, returns number of frames written
+  uint8_t update();
+  // channel = { 0, 1, 2 = any }
+  bool    isFading(uint8_t channel = 2);
+  void    stopFade(uint8_t channel = 2);
+
+
 private:
   uint8_t _vol[2] = { 0, 0 };
   uint8_t _data   = 0;
   uint8_t _clock  = 0;
   bool    _muted  = false;
 
-  void    _setVolume(uint8_t channel, uint8_t volume);
+  // fade schedule per channel
+  uint16_t _fadeFrame[2][M62429_FADE_STEPS];
+  uint8_t  _fadeVolume[2][M62429_FADE_STEPS];
+  uint8_t  _fadeStep[2]     = { 0, 0 };
+  bool     _fading[2]       = { false, false };
+  uint32_t _fadeStart[2]    = { 0, 0 };
+  uint32_t _fadeDuration[2] = { 0, 0 };
+  uint16_t _lastFrame[2]    = { 0, 0 };
+
+#if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR)
+  volatile uint8_t *_dataOut;
+  volatile uint8_t *_clockOut;
+  uint8_t _dataBit;
+  uint8_t _clockBit;
+#endif
+
+  void     _setVolume(uint8_t channel, uint8_t volume);
+  uint16_t _frame(uint8_t volume);
+  void     _writeFrame(uint16_t databits);
 };
 
 
@@ -0,0 +1,86 @@
+//
+//    FILE: M62429_fade.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: demo non blocking fade volume IC FM62429
+//    DATE: 2021-09-06
+
+
+#include "M62429.h"
+
+uint32_t start, stop;
+uint32_t lastPrint = 0;
+
+M62429  AMP;
+
+uint8_t state = 0;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println(M62429_VERSION);
+
+  AMP.begin(4, 5);
+
+  // time to write one frame
+  start = micros();
+  AMP.setVolume(0, 100);
+  stop = micros();
+  Serial.print("setVolume (us): ");
+  Serial.println(stop - start);
+
+  // time update() needs in the main loop
+  AMP.fade(2, 200, 1000);
+  uint32_t maxTime = 0;
+  while (AMP.isFading())
+  {
+    start = micros();
+    AMP.update();
+    stop = micros();
+    if (stop - start > maxTime) maxTime = stop - start;
+  }
+  Serial.print("max update (us): ");
+  Serial.println(maxTime);
+  Serial.println();
+}
+
+
+void loop()
+{
+  AMP.update();
+
+  // other work of the main loop here
+
+  if (!AMP.isFading())
+  {
+    switch (state)
+    {
+      case 0:
+        // fade out left, slow fade in right
+        AMP.fade(0, 0, 2000, M62429_FADE_LOG);
+        AMP.fade(1, 255, 4000);
+        break;
+      case 1:
+        // both to the middle
+        AMP.fade(2, 128, 1000);
+        break;
+      case 2:
+        AMP.fade(2, 0, 3000, M62429_FADE_LOG);
+        break;
+    }
+    state = (state + 1) % 3;
+  }
+
+  if (millis() - lastPrint >= 100)
+  {
+    lastPrint = millis();
+    Serial.print(AMP.getVolume(0));
+    Serial.print("\t");
+    Serial.println(AMP.getVolume(1));
+  }
+}
+
+
+// -- END OF FILE --
@@ -102,6 +102,103 @@ unittest(test_all)
   assertEqual(5, AMP.getVolume(0));
 }
 
+
+unittest(test_fade_linear)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  M62429 AMP;
+  AMP.begin(6, 7);
+  assertFalse(AMP.isFading());
+
+  // 320 ms => 10 ms per step
+  assertEqual(0, AMP.fade(2, 64, 320));
+  assertTrue(AMP.isFading());
+  assertTrue(AMP.isFading(0));
+  assertTrue(AMP.isFading(1));
+  assertEqual(0, AMP.update());       // not due yet
+
+  state->micros += 10000;
+  // volume 2 has the same frame as 0 => not written
+  assertEqual(0, AMP.update());
+  assertEqual(2, AMP.getVolume(0));
+  assertEqual(2, AMP.getVolume(1));
+
+  state->micros += 20000;
+  // same frame for both channels => one frame
+  assertEqual(1, AMP.update());
+  assertEqual(6, AMP.getVolume(0));
+  assertEqual(6, AMP.getVolume(1));
+
+  state->micros += 150000;            // late, jump to step 18
+  AMP.update();
+  assertEqual(36, AMP.getVolume(0));
+
+  state->micros += 140000;
+  AMP.update();
+  assertFalse(AMP.isFading());
+  assertEqual(64, AMP.getVolume(0));
+  assertEqual(64, AMP.getVolume(1));
+  assertEqual(0, AMP.update());
+}
+
+
+unittest(test_fade_channels)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  M62429 AMP;
+  AMP.begin(6, 7);
+  AMP.setVolume(1, 200);
+
+  assertEqual(0, AMP.fade(0, 255, 320, M62429_FADE_LOG));
+  assertEqual(0, AMP.fade(1, 0, 640));
+  assertEqual(M62429_CHANNEL_ERROR, AMP.fade(3, 0, 640));
+
+  // LOG curve is fast at start
+  state->micros += 20000;
+  assertEqual(2, AMP.update());
+  assertMore(AMP.getVolume(0), 2 * 255 / 32);
+  assertEqual(194, AMP.getVolume(1));
+
+  state->micros += 300000;
+  AMP.update();
+  assertFalse(AMP.isFading(0));
+  assertTrue(AMP.isFading(1));
+  assertEqual(255, AMP.getVolume(0));
+  assertEqual(100, AMP.getVolume(1));
+
+  // setVolume() stops the fade of that channel
+  AMP.setVolume(1, 42);
+  assertFalse(AMP.isFading());
+  state->micros += 320000;
+  assertEqual(0, AMP.update());
+  assertEqual(42, AMP.getVolume(1));
+
+  // timing of frames, 1 second fade 0 -> 255, update every ms
+  AMP.setVolume(2, 0);
+  AMP.fade(2, 255, 1000);
+  int frames = 0;
+  uint32_t last = state->micros;
+  uint32_t maxGap = 0;
+  for (int ms = 1; ms <= 1100; ms++)
+  {
+    state->micros += 1000;
+    if (AMP.update() > 0)
+    {
+      frames++;
+      if (state->micros - last > maxGap) maxGap = state->micros - last;
+      last = state->micros;
+    }
+  }
+  assertEqual(32, frames);
+  assertLessOrEqual(maxGap, 1000000 / 32 + 1000);
+  fprintf(stderr, "frames: %d  max gap: %lu us\n", frames, (unsigned long)maxGap);
+}
+
+
 unittest_main()
 
 // --------
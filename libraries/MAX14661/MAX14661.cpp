@@ -2,13 +2,14 @@
 //    FILE: MAX14661.cpp
 //  AUTHOR: Rob Tillaart
 //    DATE: 2021-01-29
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: Arduino library for MAX14661 16 channel I2C multiplexer
 //     URL: https://github.com/RobTillaart/MAX14661
 //
 //  HISTORY:
 //   0.1.0  2021-01-29  initial version
 //   0.1.1  2021-08-30  add shadow interface - experimental
+//   0.1.2  2021-09-04  add program interface, fix open/closeShadowChannelB()
 
 
 #include "MAX14661.h"
@@ -32,6 +33,13 @@ MAX14661::MAX14661(const uint8_t deviceAddress, TwoWire *wire)
 {
   _address = deviceAddress;
   _wire    = wire;
+  _error   = 0;
+
+  _maskA   = NULL;
+  _maskB   = NULL;
+  _steps   = 0;
+  _step    = 0;
+  _shadowValid = false;
 }
 
 
@@ -263,10 +271,10 @@ bool MAX14661::openShadowChannelB(uint8_t channel)
 {
   if (channel > 15) return false;
   uint8_t ch = channel;
-  uint8_t reg = MAX14661_SHDW0;
+  uint8_t reg = MAX14661_SHDW2;
   if (ch > 7)
   {
-    reg = MAX14661_SHDW1;
+    reg = MAX14661_SHDW3;
     ch -= 8;
   }
   uint8_t mask = readRegister(reg);
@@ -309,6 +317,53 @@ bool MAX14661::isOpenShadowChannelB(uint8_t channel)
 
 
 
+/////////////////////////////////////////////////////////
+//
+// PROGRAM INTERFACE
+//
+bool MAX14661::loadProgram(const uint16_t * maskA, const uint16_t * maskB, uint16_t steps)
+{
+  if ((maskA == NULL) || (steps == 0)) return false;
+  _maskA = maskA;
+  _maskB = maskB;
+  _steps = steps;
+  resetProgram();
+  return true;
+}
+
+
+void MAX14661::resetProgram()
+{
+  _step = 0;
+  _shadowValid = false;
+}
+
+
+bool MAX14661::step()
+{
+  if (_step >= _steps) return false;
+  uint16_t a = _maskA[_step];
+  uint16_t b = (_maskB == NULL) ? a : _maskB[_step];
+  if (_writeShadow(a, b) != 0) return false;
+  _step++;
+  return true;
+}
+
+
+uint16_t MAX14661::runProgram(MAX14661_callback callback)
+{
+  uint16_t count = 0;
+  while (_step < _steps)
+  {
+    uint16_t s = _step;
+    if (!step()) break;
+    count++;
+    if (callback != NULL) callback(s);
+  }
+  return count;
+}
+
+
 /////////////////////////////////////////////////////////
 //
 // MUX INTERFACE
@@ -438,6 +493,10 @@ uint8_t MAX14661::readRegister(uint8_t reg)
 
 int MAX14661::writeRegister(uint8_t reg, uint8_t value)
 {
+  if ((reg >= MAX14661_SHDW0) && (reg <= MAX14661_SHDW3))
+  {
+    _shadowValid = false;
+  }
   _wire->beginTransmission(_address);
   _wire->write(reg);
   _wire->write(value);
@@ -454,6 +513,44 @@ int MAX14661::lastError()
 }
 
 
+/////////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+
+// SHDW0..SHDW3, CMD_A and CMD_B are consecutive registers so they are
+// written in one transaction, starting at the first changed shadow byte.
+// both CMD registers copy the shadow to the switches at once.
+int MAX14661::_writeShadow(uint16_t maskA, uint16_t maskB)
+{
+  uint8_t regs[4] = { (uint8_t)(maskA & 0xFF), (uint8_t)(maskA >> 8),
+                      (uint8_t)(maskB & 0xFF), (uint8_t)(maskB >> 8) };
+  uint8_t first = 0;
+  if (_shadowValid)
+  {
+    while ((first < 4) && (regs[first] == _shadow[first])) first++;
+  }
+
+  _wire->beginTransmission(_address);
+  _wire->write(MAX14661_SHDW0 + first);
+  for (uint8_t i = first; i < 4; i++)
+  {
+    _wire->write(regs[i]);
+  }
+  _wire->write(0x11);      // CMD_A
+  _wire->write(0x11);      // CMD_B
+  _error = _wire->endTransmission();
+  if (_error != 0)
+  {
+    _shadowValid = false;
+    return _error;
+  }
+  for (uint8_t i = 0; i < 4; i++) _shadow[i] = regs[i];
+  _shadowValid = true;
+  return _error;
+}
+
+
 
 
 // -- END OF FILE --
@@ -3,7 +3,7 @@
 //    FILE: MAX14661.h
 //  AUTHOR: Rob Tillaart
 //    DATE: 2021-01-29
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: Arduino library for MAX14661 16 channel I2C multiplexer
 //     URL: https://github.com/RobTillaart/MAX14661
 //
@@ -13,7 +13,11 @@
 #include "Wire.h"
 
 
-#define MAX14661_LIB_VERSION     (F("0.1.1"))
+#define MAX14661_LIB_VERSION     (F("0.1.2"))
+
+
+// called after every program step, e.g. to do a measurement.
+typedef void (*MAX14661_callback)(uint16_t step);
 
 
 class MAX14661
@@ -72,6 +76,25 @@ public:
   bool     isOpenShadowChannelB(uint8_t channel);
 
 
+  //
+  // PROGRAM INTERFACE
+  // - experimental
+  // - steps through lists of A and B channel masks via the shadow registers.
+  // - every step is one I2C transaction, only changed shadow bytes are written.
+  // - maskB == NULL ==> B lines follow A lines (pair).
+  // - the arrays must stay valid while the program is used.
+  //
+  bool     loadProgram(const uint16_t * maskA, const uint16_t * maskB, uint16_t steps);
+  void     resetProgram();
+  // executes next step, returns false at end of program.
+  bool     step();
+  // executes all remaining steps, calls callback after every switch.
+  // returns number of steps executed.
+  uint16_t runProgram(MAX14661_callback callback = NULL);
+  uint16_t getStep()       { return _step; };
+  uint16_t getProgramSize() { return _steps; };
+
+
   //
   // MUX INTERFACE
   // - allows only one channel simultaneously open
@@ -112,9 +135,15 @@ private:
 
   int      _error;
 
+  // program
+  const uint16_t * _maskA;
+  const uint16_t * _maskB;
+  uint16_t _steps;
+  uint16_t _step;
+  uint8_t  _shadow[4];
+  bool     _shadowValid;
 
-
-// cache direct registers?
+  int      _writeShadow(uint16_t maskA, uint16_t maskB);
 };
 
 
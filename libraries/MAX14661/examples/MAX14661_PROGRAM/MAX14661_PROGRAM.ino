@@ -0,0 +1,82 @@
+//
+//    FILE: MAX14661_PROGRAM.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: demo PROGRAM interface - scan all A/B channel pairs
+//    DATE: 2021-09-04
+//     URL: https://github.com/RobTillaart/MAX14661
+//
+
+
+#include "Wire.h"
+#include "MAX14661.h"
+
+MAX14661 mux(0x4C);  // 0x4C..0x4F
+
+// A = excitation, B = sense, all 16 x 15 combinations
+uint16_t maskA[240];
+uint16_t maskB[240];
+
+int values[240];
+
+uint32_t start, stop;
+
+
+void measure(uint16_t step)
+{
+  values[step] = analogRead(A0);
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println(MAX14661_LIB_VERSION);
+
+  Wire.begin();
+  Wire.setClock(400000);
+  if (mux.begin() == false)
+  {
+    Serial.println("Could not find MAX14661");
+    while (1);
+  }
+
+  uint16_t n = 0;
+  for (uint8_t a = 0; a < 16; a++)
+  {
+    for (uint8_t b = 0; b < 16; b++)
+    {
+      if (a == b) continue;
+      maskA[n] = 1 << a;
+      maskB[n] = 1 << b;
+      n++;
+    }
+  }
+  mux.loadProgram(maskA, maskB, n);
+
+  start = micros();
+  uint16_t steps = mux.runProgram();
+  stop = micros();
+  Serial.print("STEPS:\t");
+  Serial.println(steps);
+  Serial.print("TIME:\t");
+  Serial.println(stop - start);
+  Serial.print("RATE:\t");
+  Serial.println(steps * 1e6 / (stop - start));
+
+  mux.resetProgram();
+  start = micros();
+  steps = mux.runProgram(measure);
+  stop = micros();
+  Serial.print("WITH MEASUREMENT:\t");
+  Serial.println(stop - start);
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
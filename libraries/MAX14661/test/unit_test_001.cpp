@@ -56,6 +56,104 @@ unittest(test_constructor)
 }
 
 
+uint16_t measured = 0;
+uint16_t lastStep = 0;
+
+void measure(uint16_t step)
+{
+  measured++;
+  lastStep = step;
+}
+
+
+unittest(test_program)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x4C);
+
+  MAX14661 MUX(0x4C);
+  MUX.begin();
+
+  uint16_t A[4] = { 0x0001, 0x0002, 0x0002, 0x0100 };
+  uint16_t B[4] = { 0x8000, 0x4000, 0x2000, 0x2000 };
+
+  assertFalse(MUX.loadProgram(NULL, B, 4));
+  assertTrue(MUX.loadProgram(A, B, 4));
+  assertEqual(4, MUX.getProgramSize());
+  assertEqual(0, MUX.getStep());
+
+  // first step writes all 4 shadow bytes + CMD_A + CMD_B
+  assertTrue(MUX.step());
+  assertEqual(7, mosi->size());
+  assertEqual(0x10, mosi->at(0));
+  assertEqual(0x01, mosi->at(1));
+  assertEqual(0x80, mosi->at(4));
+  assertEqual(0x11, mosi->at(5));
+  assertEqual(0x11, mosi->at(6));
+
+  // A low byte changed ==> all from SHDW0
+  mosi->clear();
+  assertTrue(MUX.step());
+  assertEqual(7, mosi->size());
+
+  // only B high byte changed ==> start at SHDW3
+  mosi->clear();
+  assertTrue(MUX.step());
+  assertEqual(4, mosi->size());
+  assertEqual(0x13, mosi->at(0));
+  assertEqual(0x20, mosi->at(1));
+
+  // A changed, B the same, A high byte ==> start at SHDW0
+  mosi->clear();
+  assertTrue(MUX.step());
+  assertEqual(7, mosi->size());
+
+  assertFalse(MUX.step());
+  assertEqual(4, MUX.getStep());
+
+  // run again with callback
+  MUX.resetProgram();
+  measured = 0;
+  mosi->clear();
+  assertEqual(4, MUX.runProgram(measure));
+  assertEqual(4, measured);
+  assertEqual(3, lastStep);
+  assertEqual(7 + 7 + 4 + 7, mosi->size());   // 4 transactions
+
+  // step rate from I2C bit times at 400 KHz, 7 bytes worst case
+  float program = 400000.0 / (1 + 9 + 7 * 9 + 1);
+  // setShadowChannelMaskA() + setShadowChannelMaskB() + activateShadow()
+  float separate = 400000.0 / (6 * (1 + 9 + 2 * 9 + 1));
+  fprintf(stderr, "program:  %6.0f steps/sec\n", program);
+  fprintf(stderr, "separate: %6.0f steps/sec\n", separate);
+}
+
+
+unittest(test_program_pair)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x4C);
+
+  MAX14661 MUX(0x4C);
+  MUX.begin();
+
+  uint16_t A[3] = { 0x0001, 0x0002, 0x0004 };
+  assertTrue(MUX.loadProgram(A, NULL, 3));
+  assertEqual(3, MUX.runProgram());
+  // B follows A
+  assertEqual(0x04, mosi->at(7 + 7 + 3));
+  assertEqual(21, mosi->size());
+
+  // direct shadow access invalidates the cache
+  MUX.resetProgram();
+  MUX.step();
+  MUX.setShadowChannelMaskA(0x0000);
+  mosi->clear();
+  MUX.step();
+  assertEqual(7, mosi->size());
+}
+
+
 unittest_main()
 
 // --------
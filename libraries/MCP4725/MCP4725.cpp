@@ -2,7 +2,7 @@
 //    FILE: MCP4725.cpp
 //  AUTHOR: Rob Tillaart
 // PURPOSE: Arduino library for 12 bit I2C DAC - MCP4725 
-// VERSION: 0.3.2
+// VERSION: 0.3.3
 //     URL: https://github.com/RobTillaart/MCP4725
 //
 //  HISTORY:
@@ -25,6 +25,7 @@
 //  0.3.0   2021-01-15  Add WireN support (e.g. teensy)
 //  0.3.1   2021-05-27  Fix arduino-CI / arduino-lint
 //  0.3.2   2021-06-06  Verify input of setPercentage()
+//  0.3.3   2021-09-02  add writeStream() + paced streaming
 
 
 #include "MCP4725.h"
@@ -46,6 +47,13 @@ MCP4725::MCP4725(const uint8_t deviceAddress, TwoWire *wire)
   _lastValue       = 0;
   _powerDownMode   = 0;
   _lastWriteEEPROM = 0;
+  _streamBuffer    = NULL;
+  _streamLength    = 0;
+  _streamIndex     = 0;
+  _streamInterval  = 0;
+  _streamNext      = 0;
+  _streamCount     = 0;
+  _streamRepeat    = false;
 }
 
 
@@ -148,6 +156,73 @@ uint16_t MCP4725::readEEPROM()
 }
 
 
+// PAGE 18 DATASHEET
+// fast mode accepts repeated 2 byte words in one transaction.
+uint16_t MCP4725::writeStream(const uint16_t * samples, const uint16_t n)
+{
+  uint8_t  pdm = _powerDownMode << 4;
+  uint16_t written = 0;
+  while (written < n)
+  {
+    uint16_t count = n - written;
+    if (count > MCP4725_STREAM_SAMPLES) count = MCP4725_STREAM_SAMPLES;
+
+    _wire->beginTransmission(_deviceAddress);
+    for (uint16_t i = 0; i < count; i++)
+    {
+      uint16_t value = samples[written + i];
+      _wire->write(((value >> 8) & 0x0F) | pdm);
+      _wire->write(value & 0xFF);
+    }
+    if (_wire->endTransmission() != 0) break;
+    written += count;
+    _lastValue = samples[written - 1] & MCP4725_MAXVALUE;
+  }
+  return written;
+}
+
+
+void MCP4725::startStream(const uint16_t * samples, const uint16_t n, const uint32_t interval, const bool repeat)
+{
+  if ((samples == NULL) || (n == 0)) return;
+  _streamBuffer   = samples;
+  _streamLength   = n;
+  _streamIndex    = 0;
+  _streamInterval = interval;
+  _streamRepeat   = repeat;
+  _streamCount    = 0;
+  _streamNext     = micros();
+}
+
+
+uint16_t MCP4725::updateStream()
+{
+  if (_streamBuffer == NULL) return 0;
+  // interval 0 == as fast as the bus allows
+  uint32_t count = MCP4725_STREAM_SAMPLES;
+  if (_streamInterval > 0)
+  {
+    uint32_t late = micros() - _streamNext;
+    if (late >= 0x80000000UL) return 0;     // next sample not due yet
+    count = 1 + late / _streamInterval;
+  }
+  if (count > MCP4725_STREAM_SAMPLES) count = MCP4725_STREAM_SAMPLES;
+  // do not wrap within one transaction
+  if (count > (uint32_t)(_streamLength - _streamIndex)) count = _streamLength - _streamIndex;
+
+  uint16_t written = writeStream(&_streamBuffer[_streamIndex], count);
+  _streamCount += written;
+  _streamNext  += written * _streamInterval;
+  _streamIndex += written;
+  if (_streamIndex >= _streamLength)
+  {
+    _streamIndex = 0;
+    if (!_streamRepeat) _streamBuffer = NULL;
+  }
+  return written;
+}
+
+
 // depending on bool EEPROM the value of PDM is written to
 // (false) DAC or
 // (true) DAC & EEPROM,
@@ -3,7 +3,7 @@
 //    FILE: MCP4725.h
 //  AUTHOR: Rob Tillaart
 // PURPOSE: Arduino library for 12 bit I2C DAC - MCP4725 
-// VERSION: 0.3.2
+// VERSION: 0.3.3
 //     URL: https://github.com/RobTillaart/MCP4725
 //
 
@@ -12,13 +12,22 @@
 #include "Arduino.h"
 
 
-#define MCP4725_VERSION         (F("0.3.2"))
+#define MCP4725_VERSION         (F("0.3.3"))
 
 
 // constants
 #define MCP4725_MAXVALUE        4095
 
 
+// fast mode writes 2 bytes per sample, no register byte.
+#if defined(ESP32) || defined(ESP8266)
+#define MCP4725_I2C_BUFFERSIZE  128
+#else
+#define MCP4725_I2C_BUFFERSIZE  32     // AVR, STM
+#endif
+#define MCP4725_STREAM_SAMPLES  (MCP4725_I2C_BUFFERSIZE / 2)
+
+
 // errors
 #define MCP4725_OK              0
 #define MCP4725_VALUE_ERROR     -999
@@ -65,6 +74,22 @@ public:
   uint16_t readEEPROM();
 
 
+  // STREAMING - fast mode
+  // writes n samples with as few I2C transactions as the buffer allows
+  // MCP4725_STREAM_SAMPLES per transaction, values are masked to 12 bit.
+  // returns number of samples written.
+  uint16_t writeStream(const uint16_t * samples, const uint16_t n);
+
+  // paced streaming from a buffer, interval in micros per sample.
+  // updateStream() must be called as often as possible, it writes all
+  // samples that are due in one transaction (catch up, no samples skipped).
+  void     startStream(const uint16_t * samples, const uint16_t n, const uint32_t interval, const bool repeat = true);
+  void     stopStream()   { _streamBuffer = NULL; };
+  bool     isStreaming()  { return _streamBuffer != NULL; };
+  uint16_t updateStream();
+  uint32_t getStreamCount() { return _streamCount; };
+
+
   // experimental
   int      writePowerDownMode(const uint8_t PDM, const bool EEPROM = false);
   uint8_t  readPowerDownModeEEPROM();
@@ -85,6 +110,14 @@ private:
 
   int      _generalCall(const uint8_t gc);
 
+  const uint16_t * _streamBuffer;
+  uint16_t _streamLength;
+  uint16_t _streamIndex;
+  uint32_t _streamInterval;
+  uint32_t _streamNext;
+  uint32_t _streamCount;
+  bool     _streamRepeat;
+
   TwoWire*  _wire;
 };
 
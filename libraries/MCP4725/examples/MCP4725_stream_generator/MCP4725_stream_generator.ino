@@ -0,0 +1,76 @@
+//
+//    FILE: MCP4725_stream_generator.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: measure writeStream() and paced streaming of a sine table
+//    DATE: 2021-09-02
+//     URL: https://github.com/RobTillaart/MCP4725
+//
+// the table can also be filled by e.g. the FunctionGenerator library.
+
+
+#include "MCP4725.h"
+#include "Wire.h"
+
+
+MCP4725 MCP(0x62);
+
+const uint16_t SAMPLES = 64;
+uint16_t sine[SAMPLES];
+
+uint32_t start, stop;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("MCP4725_VERSION: ");
+  Serial.println(MCP4725_VERSION);
+
+  for (uint16_t i = 0; i < SAMPLES; i++)
+  {
+    sine[i] = 2047 + round(2047 * sin(i * TWO_PI / SAMPLES));
+  }
+
+  Wire.begin();
+  MCP.begin();
+
+  uint32_t clocks[2] = { 400000, 3400000 };
+  for (uint8_t c = 0; c < 2; c++)
+  {
+    Wire.setClock(clocks[c]);
+    Serial.print("\nCLOCK: ");
+    Serial.println(clocks[c]);
+
+    start = micros();
+    for (uint16_t i = 0; i < SAMPLES; i++)
+    {
+      MCP.setValue(sine[i]);
+    }
+    stop = micros();
+    Serial.print("setValue():\t");
+    Serial.print(SAMPLES * 1e6 / (stop - start));
+    Serial.println(" samples/sec");
+
+    start = micros();
+    MCP.writeStream(sine, SAMPLES);
+    stop = micros();
+    Serial.print("writeStream():\t");
+    Serial.print(SAMPLES * 1e6 / (stop - start));
+    Serial.println(" samples/sec");
+  }
+  Wire.setClock(400000);
+
+  // 64 samples x 100 us = 156.25 Hz sine
+  MCP.startStream(sine, SAMPLES, 100);
+}
+
+
+void loop()
+{
+  MCP.updateStream();
+}
+
+
+// -- END OF FILE --
@@ -95,6 +95,78 @@ unittest(test_writeDAC)
   assertEqual(MCP4725_VALUE_ERROR, MCP.writeDAC(4096, true));
 }
 
+
+// I2C bit times, START + address + ACK + n * (2 bytes + 2 ACK) + STOP
+float samplesPerSecond(uint32_t clock, uint16_t samplesPerTransaction)
+{
+  uint32_t bits = 1 + 9 + samplesPerTransaction * 18 + 1;
+  return (float)clock * samplesPerTransaction / bits;
+}
+
+
+unittest(test_writeStream)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x62);
+  MCP4725 MCP(0x62);
+  Wire.begin();
+
+  uint16_t samples[100];
+  for (int i = 0; i < 100; i++) samples[i] = i * 40;
+  samples[99] = 0xF123;    // masked to 12 bit
+
+  assertEqual(100, MCP.writeStream(samples, 100));
+  assertEqual(200, mosi->size());
+  assertEqual(0x00, mosi->at(0));
+  assertEqual(0x00, mosi->at(1));
+  assertEqual(0x00, mosi->at(2));
+  assertEqual(40, mosi->at(3));
+  assertEqual(0x01, mosi->at(198));
+  assertEqual(0x23, mosi->at(199));
+  assertEqual(0x0123, MCP.getValue());
+
+  fprintf(stderr, "samples per transaction: %d\n", MCP4725_STREAM_SAMPLES);
+  float single = samplesPerSecond(400000, 1);
+  float stream = samplesPerSecond(400000, MCP4725_STREAM_SAMPLES);
+  fprintf(stderr, "400 KHz setValue():    %8.0f samples/sec\n", single);
+  fprintf(stderr, "400 KHz writeStream(): %8.0f samples/sec\n", stream);
+  fprintf(stderr, "3.4 MHz setValue():    %8.0f samples/sec\n", samplesPerSecond(3400000, 1));
+  fprintf(stderr, "3.4 MHz writeStream(): %8.0f samples/sec\n", samplesPerSecond(3400000, MCP4725_STREAM_SAMPLES));
+  assertMore(stream, 1.5 * single);
+}
+
+
+unittest(test_paced_stream)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x62);
+  MCP4725 MCP(0x62);
+  Wire.begin();
+
+  uint16_t samples[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+  assertFalse(MCP.isStreaming());
+  MCP.startStream(samples, 10, 100, false);
+  assertTrue(MCP.isStreaming());
+
+  assertEqual(1, MCP.updateStream());      // first sample immediately
+  assertEqual(0, MCP.updateStream());
+  state->micros = 50;
+  assertEqual(0, MCP.updateStream());
+  state->micros = 350;
+  assertEqual(3, MCP.updateStream());      // catch up in one transaction
+  assertEqual(3, MCP.getValue());
+  state->micros = 10000;
+  assertEqual(6, MCP.updateStream());      // end of buffer
+  assertFalse(MCP.isStreaming());
+  assertEqual(10, MCP.getStreamCount());
+  assertEqual(20, mosi->size());
+  assertEqual(9, MCP.getValue());
+}
+
+
 unittest_main()
 
 // --------
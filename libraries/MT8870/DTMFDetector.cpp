@@ -0,0 +1,278 @@
+//
+//    FILE: DTMFDetector.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.3
+//    DATE: 2021-09-10
+// PURPOSE: Arduino library for software DTMF and tone detection (Goertzel)
+//     URL: https://github.com/RobTillaart/MT8870
+//
+//  HISTORY:
+//  0.1.3   2021-09-10  initial version
+
+
+#include "DTMFDetector.h"
+
+
+// rows 697 770 852 941, columns 1209 1336 1477 1633 Hz
+static const float DTMF_FREQ[8] = { 697, 770, 852, 941, 1209, 1336, 1477, 1633 };
+
+// keypad position => MT8870 raw code, "D1234567890*#ABC"[code]
+static const uint8_t DTMF_RAW[4][4] =
+{
+  {  1,  2,  3, 13 },     //  1 2 3 A
+  {  4,  5,  6, 14 },     //  4 5 6 B
+  {  7,  8,  9, 15 },     //  7 8 9 C
+  { 11, 10, 12,  0 }      //  * 0 # D
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// GOERTZEL
+//
+Goertzel::Goertzel()
+{
+  _coef = 0;
+  reset();
+}
+
+
+void Goertzel::begin(float frequency, float sampleRate)
+{
+  float c = 2 * cos(2 * PI * frequency / sampleRate) * 16384;
+  if (c > 32767)  c = 32767;
+  if (c < -32768) c = -32768;
+  _coef = round(c);
+  reset();
+}
+
+
+float Goertzel::power()
+{
+  float s1 = _s1;
+  float s2 = _s2;
+  return s1 * s1 + s2 * s2 - (_coef / 16384.0) * s1 * s2;
+}
+
+
+// remove bias, clip to 12 bit.
+static inline int16_t _normalize(int16_t sample, int16_t bias)
+{
+  int16_t x = sample - bias;
+  if (x > 2047)  x = 2047;
+  if (x < -2048) x = -2048;
+  return x;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DTMF DETECTOR
+//
+DTMFDetector::DTMFDetector(float sampleRate, uint16_t blockSize)
+{
+  if (blockSize > DTMF_MAX_BLOCKSIZE) blockSize = DTMF_MAX_BLOCKSIZE;
+  if (blockSize < 16) blockSize = 16;
+  _sampleRate = sampleRate;
+  _blockSize  = blockSize;
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    _tone[i].begin(DTMF_FREQ[i], sampleRate);
+  }
+  _bias = 0;
+  setThreshold(20);
+  reset();
+}
+
+
+void DTMFDetector::reset()
+{
+  for (uint8_t i = 0; i < 8; i++) _tone[i].reset();
+  _count     = 0;
+  _sum       = 0;
+  _energy    = 0;
+  _key       = DTMF_NO_KEY;
+  _candidate = DTMF_NO_KEY;
+  _last      = DTMF_NO_KEY;
+  _time      = 0;
+  _blockTime = 0;
+  _blocks    = 0;
+}
+
+
+void DTMFDetector::setThreshold(uint16_t amplitude)
+{
+  _threshold = amplitude;
+  float p = amplitude * _blockSize * 0.5;
+  _minPower = p * p;
+}
+
+
+bool DTMFDetector::add(int16_t sample)
+{
+  _sum += sample;
+  int16_t x = _normalize(sample, _bias);
+  _energy += (int32_t)x * x;
+  for (uint8_t i = 0; i < 8; i++) _tone[i].add(x);
+  if (++_count < _blockSize) return false;
+  _evaluate();
+  return true;
+}
+
+
+uint8_t DTMFDetector::process(const int16_t * samples, uint16_t n)
+{
+  uint8_t blocks = 0;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < n; i++)
+  {
+    if (add(samples[i]))
+    {
+      uint32_t now = micros();
+      _blockTime = _time + (now - start);
+      _time = 0;
+      start = now;
+      blocks++;
+    }
+  }
+  _time += micros() - start;
+  return blocks;
+}
+
+
+char DTMFDetector::read()
+{
+  uint8_t n = readRaw();
+  if (n < 16) return "D1234567890*#ABC"[n];
+  return 255;
+}
+
+
+float DTMFDetector::getLoad()
+{
+  return _blockTime * _sampleRate / (_blockSize * 1e6);
+}
+
+
+// checks are similar to the MT8870 / ITU Q.24
+// - both tones above threshold
+// - twist between the tones less than 8 dB
+// - the other tones in the group at least 6 dB below the strongest
+// - the two tones contain at least half of the signal energy
+void DTMFDetector::_evaluate()
+{
+  float p[8];
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    p[i] = _tone[i].power();
+    _tone[i].reset();
+  }
+  // pure tones: sum of |X|^2 == energy * N / 2
+  float energy = _energy * (_blockSize * 0.5);
+
+  uint8_t row = 0;
+  uint8_t col = 4;
+  for (uint8_t i = 1; i < 4; i++)
+  {
+    if (p[i] > p[row]) row = i;
+    if (p[i + 4] > p[col]) col = i + 4;
+  }
+
+  uint8_t code = DTMF_NO_KEY;
+  bool valid = (p[row] >= _minPower) && (p[col] >= _minPower);
+  valid = valid && (p[row] < 6.3 * p[col]) && (p[col] < 6.3 * p[row]);
+  for (uint8_t i = 0; valid && (i < 4); i++)
+  {
+    if ((i != row) && (p[i] * 4 > p[row])) valid = false;
+    if ((i + 4 != col) && (p[i + 4] * 4 > p[col])) valid = false;
+  }
+  valid = valid && ((p[row] + p[col]) * 2 > energy);
+  if (valid) code = DTMF_RAW[row][col - 4];
+
+  // a key (or no key) needs two identical blocks => guard time
+  if (code == _candidate) _key = code;
+  _candidate = code;
+
+  _bias   = _sum / (int32_t)_blockSize;
+  _sum    = 0;
+  _energy = 0;
+  _count  = 0;
+  _blocks++;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// TONE DETECTOR
+//
+ToneDetector::ToneDetector(float frequency, float sampleRate, uint16_t blockSize)
+{
+  if (blockSize > DTMF_MAX_BLOCKSIZE) blockSize = DTMF_MAX_BLOCKSIZE;
+  if (blockSize < 16) blockSize = 16;
+  _blockSize = blockSize;
+  _tone.begin(frequency, sampleRate);
+  _bias = 0;
+  _threshold = 20;
+  reset();
+}
+
+
+void ToneDetector::reset()
+{
+  _tone.reset();
+  _count     = 0;
+  _sum       = 0;
+  _energy    = 0;
+  _detected  = false;
+  _level     = 0;
+  _amplitude = 0;
+}
+
+
+void ToneDetector::setThreshold(uint16_t amplitude)
+{
+  _threshold = amplitude;
+}
+
+
+bool ToneDetector::add(int16_t sample)
+{
+  _sum += sample;
+  int16_t x = _normalize(sample, _bias);
+  _energy += (int32_t)x * x;
+  _tone.add(x);
+  if (++_count < _blockSize) return false;
+  _evaluate();
+  return true;
+}
+
+
+uint8_t ToneDetector::process(const int16_t * samples, uint16_t n)
+{
+  uint8_t blocks = 0;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    if (add(samples[i])) blocks++;
+  }
+  return blocks;
+}
+
+
+void ToneDetector::_evaluate()
+{
+  float p = _tone.power();
+  _tone.reset();
+  float energy = _energy * (_blockSize * 0.5);
+  _amplitude = 2 * sqrt(p) / _blockSize;
+  _level = (energy > 0) ? p / energy : 0;
+  if (_level > 1) _level = 1;
+  _detected = (_amplitude >= _threshold) && (_level >= 0.5);
+
+  _bias   = _sum / (int32_t)_blockSize;
+  _sum    = 0;
+  _energy = 0;
+  _count  = 0;
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,154 @@
+#pragma once
+//
+//    FILE: DTMFDetector.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.3
+//    DATE: 2021-09-10
+// PURPOSE: Arduino library for software DTMF and tone detection (Goertzel)
+//          same read() interface as the MT8870 class
+//     URL: https://github.com/RobTillaart/MT8870
+//
+
+
+#include "MT8870.h"
+
+
+// samples are 12 bit signed after bias removal, -2048 .. 2047
+// block size max 256 keeps the energy sum within 32 bit.
+#define DTMF_MAX_BLOCKSIZE        256
+#define DTMF_DEFAULT_BLOCKSIZE    205
+#define DTMF_NO_KEY               255
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// GOERTZEL - one frequency, Q14 coefficient, int32 state
+//
+class Goertzel
+{
+public:
+  Goertzel();
+
+  void     begin(float frequency, float sampleRate);
+  void     reset()        { _s1 = _s2 = 0; };
+  int16_t  coefficient()  { return _coef; };
+
+  // s = x + 2cos(w) * s1 - s2
+  // product split in high and low part so it fits in 32 bit.
+  inline void add(int16_t x)
+  {
+    int32_t s = x + (_s1 >> 14) * _coef + (((_s1 & 0x3FFF) * _coef) >> 14) - _s2;
+    _s2 = _s1;
+    _s1 = s;
+  };
+
+  // |X|^2 of the block, for a sine with amplitude A = (A * N / 2)^2
+  float    power();
+
+private:
+  int16_t  _coef;
+  int32_t  _s1;
+  int32_t  _s2;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DTMF DETECTOR
+//
+class DTMFDetector
+{
+public:
+  DTMFDetector(float sampleRate = 8000, uint16_t blockSize = DTMF_DEFAULT_BLOCKSIZE);
+
+  void     reset();
+
+  // ADC offset, e.g. 512 for a 10 bit ADC. Is tracked automatically
+  // as the mean of the previous block.
+  void     setBias(int16_t bias)          { _bias = bias; };
+  int16_t  getBias()                      { return _bias; };
+  // minimum amplitude of both tones
+  void     setThreshold(uint16_t amplitude);
+  uint16_t getThreshold()                 { return _threshold; };
+
+  // returns true if a block is complete.
+  bool     add(int16_t sample);
+  // returns the number of complete blocks.
+  uint8_t  process(const int16_t * samples, uint16_t n);
+
+  // MT8870 compatible
+  bool     available()  { return _key != DTMF_NO_KEY; };
+  char     read();
+  uint8_t  readRaw()    { _last = _key; return _key; };
+  uint8_t  lastRaw()    { return _last; };
+
+  // CPU budget, measured in process() only.
+  uint32_t getBlockTime()  { return _blockTime; };
+  // fraction of real time used, 0.25 = 25%
+  float    getLoad();
+  uint32_t getBlockCount() { return _blocks; };
+
+private:
+  void     _evaluate();
+
+  Goertzel _tone[8];
+  float    _sampleRate;
+  uint16_t _blockSize;
+  uint16_t _count;
+  int16_t  _bias;
+  int32_t  _sum;
+  uint32_t _energy;
+  uint16_t _threshold;
+  float    _minPower;
+
+  uint8_t  _key;
+  uint8_t  _candidate;
+  uint8_t  _last;
+
+  uint32_t _time;
+  uint32_t _blockTime;
+  uint32_t _blocks;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// TONE DETECTOR - single frequency, e.g. 1000 Hz test tone or 2100 Hz fax
+//
+class ToneDetector
+{
+public:
+  ToneDetector(float frequency, float sampleRate = 8000, uint16_t blockSize = DTMF_DEFAULT_BLOCKSIZE);
+
+  void     reset();
+  void     setBias(int16_t bias)          { _bias = bias; };
+  int16_t  getBias()                      { return _bias; };
+  void     setThreshold(uint16_t amplitude);
+  uint16_t getThreshold()                 { return _threshold; };
+
+  bool     add(int16_t sample);
+  uint8_t  process(const int16_t * samples, uint16_t n);
+
+  bool     available()  { return _detected; };
+  // fraction of the block energy in the tone, 0 .. 1
+  float    getLevel()   { return _level; };
+  // amplitude of the tone
+  float    getAmplitude()  { return _amplitude; };
+
+private:
+  void     _evaluate();
+
+  Goertzel _tone;
+  uint16_t _blockSize;
+  uint16_t _count;
+  int16_t  _bias;
+  int32_t  _sum;
+  uint32_t _energy;
+  uint16_t _threshold;
+  bool     _detected;
+  float    _level;
+  float    _amplitude;
+};
+
+
+// -- END OF FILE --
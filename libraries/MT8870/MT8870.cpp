@@ -1,12 +1,15 @@
 //
 //    FILE: MT8870.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.2
+// VERSION: 0.1.3
 //    DATE: 2019-02-11
 // PURPOSE: Arduino library for MT8870 DTMF decoder (breakout)
 //     URL: https://github.com/RobTillaart/MT8870
 //          https://www.tinytronics.nl/shop/nl/sensoren/geluid/mt8870-dtmf-module
 //
+//  HISTORY:
+//  0.1.3   2021-09-10  add DTMFDetector and ToneDetector, software Goertzel detection
+//
 
 #include "MT8870.h"
 
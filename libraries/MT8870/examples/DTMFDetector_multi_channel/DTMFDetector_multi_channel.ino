@@ -0,0 +1,90 @@
+//
+//    FILE: DTMFDetector_multi_channel.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: software DTMF decoding of 2 analog channels
+//    DATE: 2021-09-10
+//
+// connect the audio signals (biased at VCC/2) to A0 and A1.
+// the sample loop is paced by micros(), ~8 kHz per channel.
+// AsyncAnalog or an MCP_ADC can be used to sample too.
+
+
+#include "DTMFDetector.h"
+
+
+#define CHANNELS   2
+#define BLOCK      64
+
+DTMFDetector detector[CHANNELS];
+int16_t  buffer[CHANNELS][BLOCK];
+uint8_t  pin[CHANNELS] = { A0, A1 };
+
+char     lastKey[CHANNELS];
+uint32_t lastReport = 0;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("MT8870_LIB_VERSION: ");
+  Serial.println(MT8870_LIB_VERSION);
+
+  for (uint8_t ch = 0; ch < CHANNELS; ch++)
+  {
+    detector[ch].setBias(512);
+    lastKey[ch] = DTMF_NO_KEY;
+  }
+}
+
+
+void loop()
+{
+  // sample a block, 125 us per sample for all channels.
+  uint32_t next = micros();
+  for (uint8_t i = 0; i < BLOCK; i++)
+  {
+    while ((int32_t)(micros() - next) < 0);
+    next += 125;
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+      buffer[ch][i] = analogRead(pin[ch]);
+    }
+  }
+
+  // analyse, this time is lost for sampling in this simple sketch.
+  for (uint8_t ch = 0; ch < CHANNELS; ch++)
+  {
+    detector[ch].process(buffer[ch], BLOCK);
+    char key = detector[ch].read();
+    if (key != lastKey[ch])
+    {
+      lastKey[ch] = key;
+      if (key != (char)DTMF_NO_KEY)
+      {
+        Serial.print(ch);
+        Serial.print("\t");
+        Serial.println(key);
+      }
+    }
+  }
+
+  if (millis() - lastReport > 5000)
+  {
+    lastReport = millis();
+    Serial.print("LOAD:");
+    for (uint8_t ch = 0; ch < CHANNELS; ch++)
+    {
+      Serial.print("\t");
+      Serial.print(detector[ch].getBlockTime());
+      Serial.print(" us ");
+      Serial.print(detector[ch].getLoad() * 100, 1);
+      Serial.print("%");
+    }
+    Serial.println();
+  }
+}
+
+
+// -- END OF FILE --
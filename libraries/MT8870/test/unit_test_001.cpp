@@ -34,6 +34,29 @@
 
 #include "Arduino.h"
 #include "MT8870.h"
+#include "DTMFDetector.h"
+
+
+// synthesize n samples of a DTMF key, 10 bit ADC style with bias 512.
+void synth(int16_t * buf, uint16_t n, char key, float amplitude, uint32_t & t, float noise = 0)
+{
+  const char * keys = "123A456B789C*0#D";
+  const float rowF[4] = { 697, 770, 852, 941 };
+  const float colF[4] = { 1209, 1336, 1477, 1633 };
+  int idx = -1;
+  for (int i = 0; i < 16; i++) if (keys[i] == key) idx = i;
+  for (uint16_t i = 0; i < n; i++, t++)
+  {
+    float v = 512;
+    if (idx >= 0)
+    {
+      v += amplitude * sin(2 * PI * rowF[idx / 4] * t / 8000.0);
+      v += amplitude * sin(2 * PI * colF[idx % 4] * t / 8000.0);
+    }
+    v += noise * (random(2001) - 1000) * 0.001;
+    buf[i] = round(v);
+  }
+}
 
 
 unittest_setup()
@@ -116,6 +139,137 @@ unittest(test_read)
   }
 }
 
+unittest(test_goertzel)
+{
+  Goertzel G;
+  G.begin(1000, 8000);
+  // 2 cos(PI/4) in Q14
+  assertEqual(23170, G.coefficient());
+
+  // sine amplitude 1000 => power = (A * N / 2)^2
+  for (int i = 0; i < 200; i++) G.add(round(1000 * sin(2 * PI * 1000 * i / 8000.0)));
+  assertEqualFloat(100000, sqrt(G.power()), 500);
+  G.reset();
+  assertEqualFloat(0, G.power(), 0.001);
+}
+
+
+unittest(test_dtmf_keys)
+{
+  DTMFDetector detector(8000);
+  assertEqual(20, detector.getThreshold());
+  detector.setBias(512);
+
+  int16_t buf[410];
+  uint32_t t = 0;
+  const char * keys = "0123456789*#ABCD";
+  for (int k = 0; k < 16; k++)
+  {
+    synth(buf, 410, keys[k], 200, t, 20);
+    assertEqual(2, detector.process(buf, 410));
+    assertTrue(detector.available());
+    assertEqual(keys[k], detector.read());
+    assertEqual(detector.lastRaw(), detector.readRaw());
+  }
+  assertEqualFloat(512, detector.getBias(), 2);
+
+  // silence => no key after two blocks
+  synth(buf, 410, ' ', 0, t, 20);
+  detector.process(buf, 410);
+  assertFalse(detector.available());
+  assertEqual(255, detector.readRaw());
+  assertEqual(34, detector.getBlockCount());
+}
+
+
+unittest(test_dtmf_reject)
+{
+  DTMFDetector detector(8000);
+  detector.setBias(512);
+  int16_t buf[410];
+  uint32_t t = 0;
+
+  // too weak
+  synth(buf, 410, '5', 10, t);
+  detector.process(buf, 410);
+  assertFalse(detector.available());
+
+  // single tone
+  for (int i = 0; i < 410; i++) buf[i] = 512 + round(300 * sin(2 * PI * 770 * i / 8000.0));
+  detector.process(buf, 410);
+  assertFalse(detector.available());
+
+  // twist > 8 dB
+  for (int i = 0; i < 410; i++)
+  {
+    buf[i] = 512 + round(400 * sin(2 * PI * 770 * i / 8000.0) + 100 * sin(2 * PI * 1336 * i / 8000.0));
+  }
+  detector.process(buf, 410);
+  assertFalse(detector.available());
+
+  // speech like, lots of energy outside the tones
+  for (int i = 0; i < 410; i++)
+  {
+    buf[i] = 512 + round(200 * sin(2 * PI * 770 * i / 8000.0) + 200 * sin(2 * PI * 1336 * i / 8000.0)
+                     + 400 * sin(2 * PI * 300 * i / 8000.0));
+  }
+  detector.process(buf, 410);
+  assertFalse(detector.available());
+
+  // one block is not enough, guard time
+  detector.reset();
+  detector.setBias(512);
+  synth(buf, 205, '5', 200, t);
+  detector.process(buf, 205);
+  assertFalse(detector.available());
+  synth(buf, 205, '5', 200, t);
+  detector.process(buf, 205);
+  assertEqual('5', detector.read());
+}
+
+
+unittest(test_multi_channel)
+{
+  DTMFDetector channel[4];
+  int16_t buf[205];
+  const char * keys = "19#D";
+  for (int ch = 0; ch < 4; ch++)
+  {
+    channel[ch].setBias(512);
+    uint32_t t = ch * 1000;
+    for (int b = 0; b < 2; b++)
+    {
+      synth(buf, 205, keys[ch], 150, t, 30);
+      channel[ch].process(buf, 205);
+    }
+  }
+  for (int ch = 0; ch < 4; ch++)
+  {
+    assertEqual(keys[ch], channel[ch].read());
+    fprintf(stderr, "%d\t%lu us\t%f\n", ch, (unsigned long)channel[ch].getBlockTime(), channel[ch].getLoad());
+    assertMoreOrEqual(channel[ch].getLoad(), 0);
+  }
+}
+
+
+unittest(test_tone_detector)
+{
+  ToneDetector tone(2100, 8000);
+  tone.setBias(512);
+  int16_t buf[205];
+  for (int i = 0; i < 205; i++) buf[i] = 512 + round(300 * sin(2 * PI * 2100 * i / 8000.0));
+  assertEqual(1, tone.process(buf, 205));
+  assertTrue(tone.available());
+  assertEqualFloat(300, tone.getAmplitude(), 5);
+  assertEqualFloat(1.0, tone.getLevel(), 0.05);
+
+  for (int i = 0; i < 205; i++) buf[i] = 512 + round(300 * sin(2 * PI * 1800 * i / 8000.0));
+  tone.process(buf, 205);
+  assertFalse(tone.available());
+  assertMore(0.1, tone.getLevel());
+}
+
+
 unittest_main()
 
 // --------
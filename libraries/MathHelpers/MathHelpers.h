@@ -2,22 +2,41 @@
 //    FILE: MathHelpers.h
 //  AUTHOR: Rob Tillaart
 //    DATE: 2018-01-21
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 //
 //
 // PUPROSE: misc functions for math and time
 //
+//  0.1.2   2021-09-21  added reentrant hex_r(), bin_r(), seconds2clock_r(),
+//                      millis2clock_r() and bulk hex_n()
+//
 #ifndef MATHHELPERS
 #define MATHHELPERS
 
-#define MATHHELPERS_VERSION (F("0.1.1"))
+#define MATHHELPERS_VERSION (F("0.1.2"))
 
 // global buffer used by all functions
 // so we do not need a static buffer in every function
 // not usable in multi-threading environments
 // results need to be printed/copied asap
+// the _r() versions use a buffer provided by the caller instead.
 char __mathHelperBuffer[17];
 
+// 00 .. 99, two digits per lookup
+static const char __mathHelperPairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+static const char __mathHelperHex[17] = "0123456789ABCDEF";
+
 
 //////////////////////////////////////////////////
 //
@@ -135,53 +154,58 @@ void sci(Stream &str, float f, uint8_t digits)
 // TIME HELPERS
 //
 
-// (true)   00:00:00 .. 23:59:59 
+// (true)   00:00:00 .. 23:59:59
 // (false)  00:00 ..    23:59
-char * seconds2clock(uint32_t seconds, bool displaySeconds=false)
+// buf must hold 9 chars.
+char * seconds2clock_r(char * buf, uint32_t seconds, bool displaySeconds = false)
 {
-  uint16_t days = seconds / 86400UL;  // strips the days
-  seconds -= (days * 86400UL);
-  uint8_t hours = seconds / 3600UL;
-  seconds -= (hours * 3600UL);
-  uint8_t minutes = seconds / 60UL;
-  seconds -= (minutes * 60UL);
-
-  uint8_t pos = 0;
-  __mathHelperBuffer[pos++] = hours/10 + '0';
-  __mathHelperBuffer[pos++] = hours%10 + '0';
-  __mathHelperBuffer[pos++]  = ':';
-  
-  __mathHelperBuffer[pos++] = minutes/10 + '0';
-  __mathHelperBuffer[pos++] = minutes%10 + '0';
+  seconds %= 86400UL;                     // strips the days
+  uint8_t  hours = seconds / 3600UL;
+  uint16_t rest  = seconds - hours * 3600UL;   // 16 bit math from here
+  uint8_t  minutes = rest / 60;
+  uint8_t  secs = rest - minutes * 60;
+
+  char * p = buf;
+  memcpy(p, &__mathHelperPairs[hours * 2], 2);
+  p[2] = ':';
+  memcpy(p + 3, &__mathHelperPairs[minutes * 2], 2);
+  p += 5;
   if (displaySeconds)
   {
-    __mathHelperBuffer[pos++]  = ':';
-    __mathHelperBuffer[pos++] = seconds/10 + '0';
-    __mathHelperBuffer[pos++] = seconds%10 + '0';
+    p[0] = ':';
+    memcpy(p + 1, &__mathHelperPairs[secs * 2], 2);
+    p += 3;
   }
-  __mathHelperBuffer[pos]  = '\0';
-  
-  return __mathHelperBuffer;
+  *p = '\0';
+  return buf;
 }
 
-char * millis2clock(uint32_t millis)
+
+char * seconds2clock(uint32_t seconds, bool displaySeconds=false)
+{
+  return seconds2clock_r(__mathHelperBuffer, seconds, displaySeconds);
+}
+
+
+// 00:00:00.000, buf must hold 13 chars.
+char * millis2clock_r(char * buf, uint32_t millis)
 {
   uint32_t t = millis/1000;
-  seconds2clock(t, true);
+  seconds2clock_r(buf, t, true);
   uint16_t m = millis - t*1000;
 
-  __mathHelperBuffer[8]  = '.';
-  uint8_t pos = 9;
+  buf[8] = '.';
   uint8_t d = m/100;
-  __mathHelperBuffer[pos++] = d + '0';
-  m = m - d * 100;
-  d = m/10;
-  __mathHelperBuffer[pos++] = d + '0';
-  d = m - d * 10;
-  __mathHelperBuffer[pos++] = d + '0';
-  __mathHelperBuffer[pos]  = '\0';
+  buf[9] = d + '0';
+  memcpy(&buf[10], &__mathHelperPairs[(m - d * 100) * 2], 2);
+  buf[12] = '\0';
+  return buf;
+}
 
-  return __mathHelperBuffer;
+
+char * millis2clock(uint32_t millis)
+{
+  return millis2clock_r(__mathHelperBuffer, millis);
 }
 
 float weeks(uint32_t seconds)
@@ -211,35 +235,63 @@ float minutes(uint32_t seconds)
 // notes:
 // - d should not exceed 16 otherwise __mathHelperBuffer overflows...
 // - no 64 bit support
+// - the _r() versions need a buffer of d + 1 chars, no limit on d.
+
+char * hex_r(char * buf, uint32_t value, uint8_t d = 8)
+{
+  buf[d] = '\0';
+  while (d > 0)
+  {
+    buf[--d] = __mathHelperHex[value & 0x0F];
+    value >>= 4;
+  }
+  return buf;
+}
+
+
+char * bin_r(char * buf, uint32_t value, uint8_t d = 8)
+{
+  buf[d] = '\0';
+  while (d > 0)
+  {
+    buf[--d] = '0' + (value & 0x01);
+    value >>= 1;
+  }
+  return buf;
+}
+
 
 char * hex(uint32_t value, uint8_t d = 8)
 {
-	if (d > 16) d = 16;
-	__mathHelperBuffer[d] = '\0';
-	while (d > 0)
-	{
-		uint8_t v = value & 0x0F;
-		value >>= 4;
-		__mathHelperBuffer[--d] = (v < 10) ? '0' + v : 'A' - 10 + v;
-	}
-	return __mathHelperBuffer;
+  if (d > 16) d = 16;
+  return hex_r(__mathHelperBuffer, value, d);
 }
 
 
 char * bin(uint32_t value, uint8_t d = 8)
 {
-    if (d > 16) d = 16;
-	__mathHelperBuffer[d] = '\0';
-	while (d > 0)
-	{
-		uint8_t v = value & 0x01;
-		value >>= 1;
-		__mathHelperBuffer[--d] = '0' + v;
-	}
-	return __mathHelperBuffer;
+  if (d > 16) d = 16;
+  return bin_r(__mathHelperBuffer, value, d);
 }
 
-  
+
+// bulk, e.g. a column of IDs. Every value is followed by sep.
+// buf is always '\0' terminated, returns the number of values written.
+uint16_t hex_n(char * buf, uint16_t size, const uint32_t * values, uint16_t n, uint8_t d = 8, char sep = '\n')
+{
+  if (size == 0) return 0;
+  uint16_t count = (size - 1) / (d + 1);
+  if (count > n) count = n;
+  char * p = buf;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    hex_r(p, values[i], d);
+    p += d;
+    *p++ = sep;
+  }
+  *p = '\0';
+  return count;
+}
 
 
 #endif  // MATHHELPERS
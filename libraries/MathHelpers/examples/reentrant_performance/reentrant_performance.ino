@@ -0,0 +1,82 @@
+//
+//    FILE: reentrant_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: compare shared buffer functions with the _r() and _n() versions
+//    DATE: 2021-09-21
+//
+
+#include "MathHelpers.h"
+
+
+#define ROWS      50
+
+uint32_t ids[ROWS];
+char     table[ROWS * 9 + 1];
+
+uint32_t start, duration;
+volatile char sink;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.println();
+
+  for (int i = 0; i < ROWS; i++) ids[i] = random(4E9);
+
+  // two results in one expression, needs the _r() versions.
+  char a[9], b[9];
+  Serial.print(hex_r(a, ids[0]));
+  Serial.print(" < ");
+  Serial.println(hex_r(b, ids[1]));
+  Serial.println();
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++) sink = hex(ids[i])[2];
+  duration = micros() - start;
+  Serial.print("hex():\t\t\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++) sink = hex_r(a, ids[i])[2];
+  duration = micros() - start;
+  Serial.print("hex_r():\t\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+
+  delay(10);
+  start = micros();
+  uint16_t count = hex_n(table, sizeof(table), ids, ROWS);
+  duration = micros() - start;
+  Serial.print("hex_n():\t\t");
+  Serial.println(1.0 * duration / count, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++) sink = seconds2clock(ids[i], true)[2];
+  duration = micros() - start;
+  Serial.print("seconds2clock():\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < ROWS; i++) sink = seconds2clock_r(a, ids[i], true)[2];
+  duration = micros() - start;
+  Serial.print("seconds2clock_r():\t");
+  Serial.println(1.0 * duration / ROWS, 2);
+  Serial.println("(us per value)\n");
+
+  Serial.print(table);
+  Serial.println("\nDone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
@@ -2,7 +2,7 @@
 //    FILE: PCF8591.cpp
 //  AUTHOR: Rob Tillaart
 //    DATE: 2020-03-12
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: I2C PCF8591 library for Arduino
 //     URL: https://github.com/RobTillaart/PCF8591
 //
@@ -11,6 +11,7 @@
 //  0.0.2  2020-07-22  testing, refactor, documentation and examples 
 //  0.1.0  2021-01-04  arduino-CI
 //  0.1.1  2021-01-14  added WireN + improve error handling.
+//  0.1.2  2021-09-03  add readFrames() streaming + analogWriteRead4()
 
 
 #include "PCF8591.h"
@@ -154,6 +155,37 @@ uint8_t PCF8591::analogRead4()
 }
 
 
+uint16_t PCF8591::readFrames(uint8_t * frames, uint16_t count)
+{
+  uint16_t done = 0;
+  bool writeDAC = isDACEnabled();
+  while (done < count)
+  {
+    uint16_t n = count - done;
+    if (n > PCF8591_STREAM_FRAMES) n = PCF8591_STREAM_FRAMES;
+    if (_readBurst(&frames[done * 4], n, writeDAC, _dac) != PCF8591_OK) break;
+    done += n;
+  }
+  if (done > 0)
+  {
+    for (uint8_t i = 0; i < 4; i++)
+    {
+      _adc[i] = frames[(done - 1) * 4 + i];
+    }
+  }
+  return done;
+}
+
+
+uint8_t PCF8591::analogWriteRead4(uint8_t value)
+{
+  enableDAC();
+  uint8_t rv = _readBurst(_adc, 1, true, value);
+  if (rv == PCF8591_OK) _dac = value;
+  return rv;
+}
+
+
 // DAC PART
 bool PCF8591::analogWrite(uint8_t value)
 {
@@ -178,5 +210,40 @@ int PCF8591::lastError()
 }
 
 
+//////////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+
+// control byte (+ DAC value) selects channel 0 with auto increment,
+// so the channel order is known for every burst.
+uint8_t PCF8591::_readBurst(uint8_t * frames, uint8_t count, bool writeDAC, uint8_t value)
+{
+  uint8_t control = (_control & PCF8591_DAC_FLAG) | PCF8591_INCR_FLAG;
+  _wire->beginTransmission(_address);
+  _wire->write(control);
+  if (writeDAC) _wire->write(value);
+  if (_wire->endTransmission() != 0)
+  {
+    _error = PCF8591_I2C_ERROR;
+    return _error;
+  }
+
+  uint8_t length = count * 4 + 1;
+  if (_wire->requestFrom(_address, length) != length)
+  {
+    _error = PCF8591_I2C_ERROR;
+    return _error;
+  }
+  _wire->read();                   // stale byte of previous conversion
+  for (uint8_t i = 0; i < count * 4; i++)
+  {
+    frames[i] = _wire->read();
+  }
+  _error = PCF8591_OK;
+  return _error;
+}
+
+
 
 // -- END OF FILE --
@@ -3,7 +3,7 @@
 //    FILE: PCF8591.h
 //  AUTHOR: Rob Tillaart
 //    DATE: 2020-03-12
-// VERSION: 0.1.1
+// VERSION: 0.1.2
 // PURPOSE: I2C PCF8591 library for Arduino
 //     URL: https://github.com/RobTillaart/PCF8591
 //
@@ -16,7 +16,7 @@
 #include "Wire.h"
 
 
-#define PCF8591_LIB_VERSION       (F("0.1.1"))
+#define PCF8591_LIB_VERSION       (F("0.1.2"))
 
 #define PCF8591_OK                0x00
 #define PCF8591_PIN_ERROR         0x81
@@ -30,6 +30,16 @@
 #define PCF8591_DAC_FLAG          0x40
 #define PCF8591_INCR_FLAG         0x04
 
+
+// frames of 4 channels per requestFrom(), 1 byte is the stale first byte.
+#if defined(ESP32) || defined(ESP8266)
+#define PCF8591_I2C_BUFFERSIZE    128
+#else
+#define PCF8591_I2C_BUFFERSIZE    32     // AVR, STM
+#endif
+#define PCF8591_STREAM_FRAMES     ((PCF8591_I2C_BUFFERSIZE - 1) / 4)
+
+
 class PCF8591
 {
 public:
@@ -52,6 +62,16 @@ public:
   uint8_t  analogRead4();  // returns PCF8591_OK or error code.
   uint8_t  lastRead(uint8_t channel) { return _adc[channel]; };
 
+  // STREAMING - auto increment over the 4 single ended channels.
+  // reads count frames of 4 bytes into frames[count * 4], using bursts of
+  // PCF8591_STREAM_FRAMES frames. The stale first byte of every burst
+  // is discarded. If the DAC is enabled lastWrite() is rewritten too.
+  // returns the number of frames read.
+  uint16_t readFrames(uint8_t * frames, uint16_t count);
+  // closed loop: write DAC value and read one frame (4 channels).
+  // returns PCF8591_OK or error code, values via lastRead().
+  uint8_t  analogWriteRead4(uint8_t value);
+
   // DAC PART
   void     enableDAC()      { _control |= PCF8591_DAC_FLAG; };
   void     disableDAC()     { _control &= ~PCF8591_DAC_FLAG; };
@@ -68,7 +88,9 @@ private:
   uint8_t  _dac;
   uint8_t  _adc[4];
   int      _error;
-  
+
+  uint8_t  _readBurst(uint8_t * frames, uint8_t count, bool writeDAC, uint8_t value);
+
   TwoWire* _wire;
 };
 
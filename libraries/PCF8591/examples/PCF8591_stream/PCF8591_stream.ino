@@ -0,0 +1,77 @@
+//
+//    FILE: PCF8591_stream.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: measure frames per second of readFrames() and a closed loop
+//    DATE: 2021-09-03
+//     URL: https://github.com/RobTillaart/PCF8591
+
+
+#include "PCF8591.h"
+
+PCF8591 dev(0x48);
+
+const uint16_t FRAMES = 100;
+uint8_t frames[FRAMES * 4];
+
+uint32_t start, stop;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("PCF8591_LIB_VERSION: ");
+  Serial.println(PCF8591_LIB_VERSION);
+
+  Wire.begin();
+  Wire.setClock(400000);
+  dev.begin();
+  if (! dev.isConnected())
+  {
+    Serial.println("\nFailed to connect\n");
+  }
+  delay(100);
+
+  start = micros();
+  for (uint16_t i = 0; i < FRAMES; i++)
+  {
+    dev.analogRead4();
+  }
+  stop = micros();
+  Serial.print("analogRead4():\t\t");
+  Serial.print(FRAMES * 1e6 / (stop - start));
+  Serial.println(" frames/sec");
+
+  start = micros();
+  uint16_t n = dev.readFrames(frames, FRAMES);
+  stop = micros();
+  Serial.print("readFrames():\t\t");
+  Serial.print(n * 1e6 / (stop - start));
+  Serial.println(" frames/sec");
+
+  start = micros();
+  for (uint16_t i = 0; i < FRAMES; i++)
+  {
+    dev.analogWriteRead4(i);
+  }
+  stop = micros();
+  Serial.print("analogWriteRead4():\t");
+  Serial.print(FRAMES * 1e6 / (stop - start));
+  Serial.println(" frames/sec");
+  Serial.println();
+}
+
+
+// simple closed loop, DAC output follows channel 0 (e.g. a potmeter)
+// DAC is connected to channel 1 as feedback.
+void loop()
+{
+  static uint8_t out = 0;
+  dev.analogWriteRead4(out);
+  int error = dev.lastRead(0) - dev.lastRead(1);
+  out = constrain(out + error / 2, 0, 255);
+}
+
+
+// -- END OF FILE --
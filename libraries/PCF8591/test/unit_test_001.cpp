@@ -85,6 +85,88 @@ unittest(test_DAC)
 }
 
 
+// I2C bit times, write: START + address + n bytes + STOP, all with ACK.
+uint32_t bits(uint8_t writeBytes, uint8_t readBytes)
+{
+  uint32_t b = 0;
+  if (writeBytes > 0) b += 1 + 9 + writeBytes * 9 + 1;
+  if (readBytes > 0)  b += 1 + 9 + readBytes * 9 + 1;
+  return b;
+}
+
+
+unittest(test_readFrames)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x48);
+  auto miso = Wire.getMiso(0x48);
+
+  PCF8591 dev(0x48);
+  assertTrue(dev.begin());
+  mosi->clear();
+
+  const uint16_t FRAMES = PCF8591_STREAM_FRAMES + 2;
+  for (uint16_t f = 0; f < FRAMES; f++)
+  {
+    if ((f % PCF8591_STREAM_FRAMES) == 0) miso->push_back(0xEE);   // stale byte
+    for (uint8_t ch = 0; ch < 4; ch++) miso->push_back(f + ch * 50);
+  }
+
+  uint8_t frames[FRAMES * 4];
+  assertEqual(FRAMES, dev.readFrames(frames, FRAMES));
+  assertEqual(0, miso->size());
+  assertEqual(2, mosi->size());             // 2 bursts, control byte only
+  assertEqual(PCF8591_INCR_FLAG, mosi->at(0));
+  assertFalse(dev.isINCREnabled());         // setting not changed
+
+  assertEqual(0, frames[0]);
+  assertEqual(150, frames[3]);
+  assertEqual(PCF8591_STREAM_FRAMES, frames[PCF8591_STREAM_FRAMES * 4]);
+  assertEqual(FRAMES - 1 + 150, dev.lastRead(3));
+  assertEqual(PCF8591_OK, dev.lastError());
+
+  // frames per second at 400 KHz
+  float single = 400000.0 / (4 * bits(1, 2));
+  float read4  = 400000.0 / bits(1, 5);
+  float stream = 400000.0 * PCF8591_STREAM_FRAMES / bits(1, PCF8591_STREAM_FRAMES * 4 + 1);
+  fprintf(stderr, "frames per burst: %d\n", PCF8591_STREAM_FRAMES);
+  fprintf(stderr, "4x analogRead():  %6.0f frames/sec\n", single);
+  fprintf(stderr, "analogRead4():    %6.0f frames/sec\n", read4);
+  fprintf(stderr, "readFrames():     %6.0f frames/sec\n", stream);
+  assertMore(stream, read4);
+}
+
+
+unittest(test_analogWriteRead4)
+{
+  Wire.resetMocks();
+  auto mosi = Wire.getMosi(0x48);
+  auto miso = Wire.getMiso(0x48);
+
+  PCF8591 dev(0x48);
+  assertTrue(dev.begin());
+  mosi->clear();
+
+  miso->push_back(0xEE);
+  for (uint8_t ch = 0; ch < 4; ch++) miso->push_back(10 + ch);
+
+  assertEqual(PCF8591_OK, dev.analogWriteRead4(200));
+  assertEqual(2, mosi->size());
+  assertEqual(PCF8591_DAC_FLAG | PCF8591_INCR_FLAG, mosi->at(0));
+  assertEqual(200, mosi->at(1));
+  assertEqual(200, dev.lastWrite());
+  assertTrue(dev.isDACEnabled());
+  assertEqual(10, dev.lastRead(0));
+  assertEqual(13, dev.lastRead(3));
+
+  // no data => error, DAC value not updated
+  assertEqual(PCF8591_I2C_ERROR, dev.analogWriteRead4(100));
+  assertEqual(200, dev.lastWrite());
+
+  fprintf(stderr, "analogWriteRead4(): %6.0f frames/sec at 400 KHz\n", 400000.0 / bits(2, 5));
+}
+
+
 unittest_main()
 
 // --------
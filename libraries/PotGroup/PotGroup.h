@@ -0,0 +1,205 @@
+#pragma once
+//
+//    FILE: PotGroup.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: Arduino library to ramp groups of digital potentiometers
+//    DATE: 2021-09-05
+//     URL: https://github.com/RobTillaart/PotGroup
+//
+//  HISTORY:
+//  0.1.0   2021-09-05  initial version, used by AD5144A, AD524X and AD520X
+
+
+#include "Arduino.h"
+
+
+#define POTGROUP_LIB_VERSION          (F("0.1.0"))
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// POTRAMP - start and target of max N channels of one device
+//
+// a device class holds one PotRamp and forwards to it:
+//   void    setTarget(channel, value)
+//   uint8_t getTarget(channel)
+//   void    startRamp()                  current values become the start
+//   uint8_t rampStep(step, steps)        write values(), return writes
+//   uint8_t pmCount()
+//
+template <uint8_t N>
+class PotRamp
+{
+public:
+  PotRamp(const uint8_t value = 0)
+  {
+    for (uint8_t ch = 0; ch < N; ch++)
+    {
+      _start[ch]  = value;
+      _target[ch] = value;
+    }
+  };
+
+  void    setTarget(const uint8_t channel, const uint8_t value)
+  {
+    if (channel < N) _target[channel] = value;
+  };
+
+  uint8_t getTarget(const uint8_t channel)
+  {
+    return (channel < N) ? _target[channel] : 0;
+  };
+
+  void    start(const uint8_t * current, const uint8_t count)
+  {
+    for (uint8_t ch = 0; (ch < count) && (ch < N); ch++)
+    {
+      _start[ch] = current[ch];
+    }
+  };
+
+  // linear interpolation between start and target, step = 0..steps
+  void    values(uint8_t * values, const uint8_t count, const uint16_t step, const uint16_t steps)
+  {
+    for (uint8_t ch = 0; (ch < count) && (ch < N); ch++)
+    {
+      int32_t delta = (int32_t)_target[ch] - _start[ch];
+      values[ch] = _start[ch];
+      if (steps > 0) values[ch] += delta * step / steps;
+    }
+  };
+
+private:
+  uint8_t  _start[N];
+  uint8_t  _target[N];
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// POTGROUP - ramps all channels of max SIZE devices of class POT
+//
+// the writes returned are the sum of the rampStep() return values,
+// I2C transactions or SPI channel writes depending on the device.
+//
+template <class POT, uint8_t SIZE>
+class PotGroup
+{
+public:
+  PotGroup()
+  {
+    _count     = 0;
+    _ramping   = false;
+    _step      = 0;
+    _steps     = 0;
+    _interval  = 0;
+    _rampStart = 0;
+    _writes    = 0;
+  };
+
+  // returns false if group is full
+  bool     add(POT * pot)
+  {
+    if (_count >= SIZE) return false;
+    _pot[_count++] = pot;
+    return true;
+  };
+  uint8_t  count()     { return _count; };
+
+  // device = index in order of add()
+  void     setTarget(const uint8_t device, const uint8_t channel, const uint8_t value)
+  {
+    if (device >= _count) return;
+    _pot[device]->setTarget(channel, value);
+  };
+
+  void     setTargetAll(const uint8_t value)
+  {
+    for (uint8_t d = 0; d < _count; d++)
+    {
+      for (uint8_t ch = 0; ch < _pot[d]->pmCount(); ch++)
+      {
+        _pot[d]->setTarget(ch, value);
+      }
+    }
+  };
+
+  // jump to targets immediately
+  uint16_t write()
+  {
+    _ramping = false;
+    _startAll();
+    return _rampStep(1, 1);   // step 1 of 1 == target
+  };
+
+  // interval in micros between steps, 0 = as fast as possible
+  void     startRamp(const uint16_t steps, const uint32_t interval)
+  {
+    _startAll();
+    _steps     = (steps == 0) ? 1 : steps;
+    _step      = 0;
+    _interval  = interval;
+    _rampStart = micros();
+    _ramping   = true;
+  };
+
+  void     stopRamp()  { _ramping = false; };
+  bool     isRamping() { return _ramping; };
+
+  // call as often as possible, returns writes.
+  // if called late, it jumps to the step that is due.
+  uint16_t update()
+  {
+    if (_ramping == false) return 0;
+    uint16_t due = _step + 1;
+    if (_interval > 0)
+    {
+      uint32_t d = (micros() - _rampStart) / _interval;
+      if (d > _steps) d = _steps;
+      if (d <= _step) return 0;
+      due = d;
+    }
+    _step = due;
+    if (_step >= _steps) _ramping = false;
+    return _rampStep(_step, _steps);
+  };
+
+  uint16_t getStep()   { return _step; };
+
+  uint32_t getWriteCount()   { return _writes; };
+  void     resetWriteCount() { _writes = 0; };
+
+private:
+  POT *    _pot[SIZE];
+  uint8_t  _count;
+
+  bool     _ramping;
+  uint16_t _step;
+  uint16_t _steps;
+  uint32_t _interval;
+  uint32_t _rampStart;
+  uint32_t _writes;
+
+  void     _startAll()
+  {
+    for (uint8_t d = 0; d < _count; d++)
+    {
+      _pot[d]->startRamp();
+    }
+  };
+
+  uint16_t _rampStep(const uint16_t step, const uint16_t steps)
+  {
+    uint16_t n = 0;
+    for (uint8_t d = 0; d < _count; d++)
+    {
+      n += _pot[d]->rampStep(step, steps);
+    }
+    _writes += n;
+    return n;
+  };
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,87 @@
+//
+//    FILE: PotGroup_demo.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: PotGroup demo, fade two LEDs with a PWM "device"
+//    DATE: 2021-09-05
+//     URL: https://github.com/RobTillaart/PotGroup
+//
+// the device class only needs pmCount(), setTarget(), getTarget(),
+// startRamp() and rampStep(), see AD5144A, AD524X or AD520X.
+
+
+#include "PotGroup.h"
+
+
+class PWMPot
+{
+public:
+  PWMPot(uint8_t pin0, uint8_t pin1)
+  {
+    _pin[0] = pin0;
+    _pin[1] = pin1;
+    _value[0] = _value[1] = 0;
+  };
+
+  uint8_t pmCount()  { return 2; };
+  void    setTarget(const uint8_t ch, const uint8_t value)  { _ramp.setTarget(ch, value); };
+  uint8_t getTarget(const uint8_t ch)  { return _ramp.getTarget(ch); };
+  void    startRamp()  { _ramp.start(_value, 2); };
+
+  uint8_t rampStep(const uint16_t step, const uint16_t steps)
+  {
+    uint8_t values[2];
+    uint8_t n = 0;
+    _ramp.values(values, 2, step, steps);
+    for (uint8_t ch = 0; ch < 2; ch++)
+    {
+      if (_value[ch] == values[ch]) continue;
+      _value[ch] = values[ch];
+      analogWrite(_pin[ch], _value[ch]);
+      n++;
+    }
+    return n;
+  };
+
+private:
+  uint8_t    _pin[2];
+  uint8_t    _value[2];
+  PotRamp<2> _ramp;
+};
+
+
+PWMPot leds(5, 6);
+
+PotGroup<PWMPot, 1> group;
+
+bool up = true;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("POTGROUP_LIB_VERSION: ");
+  Serial.println(POTGROUP_LIB_VERSION);
+
+  group.add(&leds);
+}
+
+
+void loop()
+{
+  group.update();
+
+  if (!group.isRamping())
+  {
+    // LED 5 fades in while LED 6 fades out, 1 second
+    group.setTarget(0, 0, up ? 255 : 0);
+    group.setTarget(0, 1, up ? 0 : 255);
+    group.startRamp(100, 10000UL);
+    up = !up;
+    Serial.println(group.getWriteCount());
+  }
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,205 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-05
+// PURPOSE: unit tests for the PotGroup library
+//          https://github.com/RobTillaart/PotGroup
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+#include <ArduinoUnitTests.h>
+
+
+#include "PotGroup.h"
+
+
+// device with 3 channels, counts the channels written.
+class FakePot
+{
+public:
+  FakePot() : _ramp(0)
+  {
+    for (uint8_t ch = 0; ch < 3; ch++) value[ch] = 0;
+  };
+
+  uint8_t value[3];
+
+  uint8_t pmCount()  { return 3; };
+  void    setTarget(const uint8_t ch, const uint8_t v)  { _ramp.setTarget(ch, v); };
+  uint8_t getTarget(const uint8_t ch)  { return _ramp.getTarget(ch); };
+  void    startRamp()  { _ramp.start(value, 3); };
+  uint8_t rampStep(const uint16_t step, const uint16_t steps)
+  {
+    uint8_t v[3];
+    uint8_t n = 0;
+    _ramp.values(v, 3, step, steps);
+    for (uint8_t ch = 0; ch < 3; ch++)
+    {
+      if (value[ch] == v[ch]) continue;
+      value[ch] = v[ch];
+      n++;
+    }
+    return n;
+  };
+
+private:
+  PotRamp<3> _ramp;
+};
+
+
+unittest_setup()
+{
+  fprintf(stderr, "POTGROUP_LIB_VERSION: %s\n", (char *) POTGROUP_LIB_VERSION);
+}
+
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_ramp)
+{
+  PotRamp<2> ramp(127);
+  assertEqual(127, ramp.getTarget(0));
+  assertEqual(0, ramp.getTarget(2));
+  ramp.setTarget(0, 255);
+  ramp.setTarget(1, 0);
+  ramp.setTarget(2, 10);       // ignored
+  assertEqual(255, ramp.getTarget(0));
+  assertEqual(0, ramp.getTarget(1));
+
+  uint8_t current[2] = { 0, 200 };
+  ramp.start(current, 2);
+  uint8_t v[2];
+  ramp.values(v, 2, 0, 4);
+  assertEqual(0, v[0]);
+  assertEqual(200, v[1]);
+  ramp.values(v, 2, 1, 4);
+  assertEqual(63, v[0]);
+  assertEqual(150, v[1]);
+  ramp.values(v, 2, 4, 4);
+  assertEqual(255, v[0]);
+  assertEqual(0, v[1]);
+  // steps == 0 => start values
+  ramp.values(v, 2, 1, 0);
+  assertEqual(0, v[0]);
+  assertEqual(200, v[1]);
+}
+
+
+unittest(test_group_add)
+{
+  FakePot pot[3];
+  PotGroup<FakePot, 2> group;
+  assertEqual(0, group.count());
+  assertTrue(group.add(&pot[0]));
+  assertTrue(group.add(&pot[1]));
+  assertFalse(group.add(&pot[2]));
+  assertEqual(2, group.count());
+
+  group.setTargetAll(100);
+  group.setTarget(1, 2, 50);
+  group.setTarget(2, 0, 50);   // ignored
+  assertEqual(100, pot[1].getTarget(0));
+  assertEqual(50, pot[1].getTarget(2));
+  assertEqual(0, pot[2].getTarget(0));
+
+  assertEqual(6, group.write());
+  assertEqual(100, pot[0].value[2]);
+  assertEqual(50, pot[1].value[2]);
+  assertEqual(0, group.write());    // nothing changed
+  assertEqual(6, group.getWriteCount());
+  group.resetWriteCount();
+  assertEqual(0, group.getWriteCount());
+}
+
+
+unittest(test_group_ramp_steps)
+{
+  FakePot pot[2];
+  PotGroup<FakePot, 8> group;
+  group.add(&pot[0]);
+  group.add(&pot[1]);
+  group.setTargetAll(100);
+
+  group.startRamp(4, 0);          // one step per update()
+  assertTrue(group.isRamping());
+  assertEqual(0, group.getStep());
+  for (int s = 1; s <= 4; s++)
+  {
+    assertEqual(6, group.update());
+    assertEqual(s, group.getStep());
+    assertEqual(25 * s, pot[1].value[0]);
+  }
+  assertFalse(group.isRamping());
+  assertEqual(0, group.update());
+
+  // stop halfway
+  group.setTargetAll(0);
+  group.startRamp(10, 0);
+  for (int s = 0; s < 5; s++) group.update();
+  group.stopRamp();
+  assertFalse(group.isRamping());
+  assertEqual(0, group.update());
+  assertEqual(50, pot[0].value[1]);
+}
+
+
+unittest(test_group_ramp_interval)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  FakePot pot;
+  PotGroup<FakePot, 8> group;
+  group.add(&pot);
+  group.setTargetAll(200);
+
+  group.startRamp(10, 1000);      // 1 ms per step
+  assertEqual(0, group.update()); // not due yet
+  state->micros += 1000;
+  assertEqual(3, group.update());
+  assertEqual(1, group.getStep());
+  assertEqual(20, pot.value[0]);
+  assertEqual(0, group.update());
+
+  // late, jumps to the step that is due
+  state->micros += 4500;
+  assertEqual(3, group.update());
+  assertEqual(5, group.getStep());
+  assertEqual(100, pot.value[0]);
+
+  state->micros += 100000;
+  group.update();
+  assertEqual(10, group.getStep());
+  assertEqual(200, pot.value[0]);
+  assertFalse(group.isRamping());
+}
+
+
+unittest_main()
+
+// --------
@@ -2,7 +2,7 @@
 //
 //    FILE: PrintSize.h
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.0
+// VERSION: 0.3.1
 // PURPOSE: Class that determines printSize
 //    DATE: 2017-12-09
 //     URL: https://github.com/RobTillaart/PrintSize
@@ -13,10 +13,13 @@
 //  0.2.1   2020-05-26  fix #1 - URLS + centering example
 //  0.2.2   2020-06-19  fix library.json
 //  0.3.0   2021-01-06  arduino-CI + unit test
+//  0.3.1   2021-09-08  add bulk write(), call statistics, bytesPerSecond()
+//                      and optional hash
 
+#include "Arduino.h"
 #include "Print.h"
 
-#define PRINTSIZE_VERSION     (F("0.3.0"))
+#define PRINTSIZE_VERSION     (F("0.3.1"))
 
 class PrintSize: public Print
 {
@@ -26,19 +29,63 @@ public:
     reset();
   };
 
-  // note: warning unused parameter - remove c to remove warning)
-  size_t write(uint8_t c)  
+  using Print::write;
+
+  size_t write(uint8_t c)
   {
     _total++;
+    _singleCalls++;
+    if (_hashing) _hash = (_hash ^ c) * 16777619UL;
     return 1;
   }
 
-  void     reset() { _total = 0; }
+  size_t write(const uint8_t * buffer, size_t size)
+  {
+    _total += size;
+    _bulkCalls++;
+    if (_hashing)
+    {
+      for (size_t i = 0; i < size; i++)
+      {
+        _hash = (_hash ^ buffer[i]) * 16777619UL;
+      }
+    }
+    return size;
+  }
+
+  void     reset()
+  {
+    _total       = 0;
+    _singleCalls = 0;
+    _bulkCalls   = 0;
+    _hash        = 2166136261UL;   // FNV-1a offset basis
+    _start       = micros();
+  }
 
   uint32_t total() { return _total; };
 
+  // STATISTICS since reset()
+  uint32_t singleCalls() { return _singleCalls; };
+  uint32_t bulkCalls()   { return _bulkCalls; };
+  float    bytesPerSecond()
+  {
+    uint32_t duration = micros() - _start;
+    if (duration == 0) return 0;
+    return _total * 1e6 / duration;
+  };
+
+  // FNV-1a 32 bit hash of all bytes since reset()
+  void     setHash(bool hashing) { _hashing = hashing; };
+  bool     getHash()  { return _hashing; };
+  uint32_t hash()     { return _hash; };
+
 private:
   uint32_t _total = 0;
+  uint32_t _singleCalls = 0;
+  uint32_t _bulkCalls = 0;
+  uint32_t _start = 0;
+  uint32_t _hash = 2166136261UL;
+  bool     _hashing = false;
 };
 
 // -- END OF FILE --
@@ -76,6 +76,58 @@ unittest(test_constructor)
 
 }
 
+
+unittest(test_statistics)
+{
+  GodmodeState* state = GODMODE();
+  state->reset();
+
+  PrintSize ps;
+  assertEqual(0, ps.total());
+  assertEqual(11, ps.print("hello world"));
+  assertEqual(11, ps.total());
+  assertEqual(1, ps.bulkCalls());
+  assertEqual(0, ps.singleCalls());
+
+  ps.write('a');
+  ps.write('b');
+  assertEqual(13, ps.total());
+  assertEqual(2, ps.singleCalls());
+
+  uint8_t buffer[100];
+  assertEqual(100, ps.write(buffer, 100));
+  assertEqual(113, ps.total());
+  assertEqual(2, ps.bulkCalls());
+
+  state->micros += 1000;
+  assertEqualFloat(113000.0, ps.bytesPerSecond(), 1);
+
+  ps.reset();
+  assertEqual(0, ps.total());
+  assertEqual(0, ps.singleCalls());
+  assertEqual(0, ps.bulkCalls());
+}
+
+
+unittest(test_hash)
+{
+  PrintSize ps;
+  assertFalse(ps.getHash());
+  ps.setHash(true);
+  assertTrue(ps.getHash());
+
+  // FNV-1a of "hello world"
+  ps.print("hello world");
+  assertEqual(0xD58B3FA7, ps.hash());
+
+  // same hash for single byte writes
+  ps.reset();
+  const char * str = "hello world";
+  for (int i = 0; i < 11; i++) ps.write(str[i]);
+  assertEqual(0xD58B3FA7, ps.hash());
+}
+
+
 unittest_main()
 
 // --------
@@ -0,0 +1,164 @@
+#pragma once
+//
+//    FILE: RingBuffer.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-18
+// PURPOSE: Arduino library for a lock free single producer single consumer ring buffer
+//     URL: https://github.com/RobTillaart/RingBuffer
+//
+//  HISTORY:
+//  0.1.0   2021-09-18  initial version
+
+
+#include "Arduino.h"
+
+
+#define RINGBUFFER_LIB_VERSION            (F("0.1.0"))
+
+
+// the index must be read and written in one instruction.
+#if defined(__AVR__)
+typedef uint8_t  rb_index_t;
+#define RINGBUFFER_MAX_SIZE               128
+#else
+typedef uint16_t rb_index_t;
+#define RINGBUFFER_MAX_SIZE               32768
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// RINGBUFFER - single producer, single consumer, no locks
+//
+// e.g. an ISR pushes, loop() pops. One side may only call the producer
+// functions, the other side only the consumer functions.
+//
+// head and tail are free running counters, only the producer writes head
+// and only the consumer writes tail. N is a power of 2 so the position
+// in the buffer is index & (N - 1) and head - tail is the count, also
+// after the counters wrap.
+//
+// the counters are loaded with acquire and stored with release semantics,
+// so the data is in the buffer before the other side sees the new counter.
+// that is a compiler barrier on AVR and a memory barrier on ARM / ESP32 / host.
+//
+template <typename T, uint16_t N>
+class RingBuffer
+{
+  static_assert((N >= 2) && ((N & (N - 1)) == 0), "RingBuffer size must be a power of 2");
+  static_assert(N <= RINGBUFFER_MAX_SIZE, "RingBuffer size too large");
+
+public:
+  RingBuffer()
+  {
+    _head = 0;
+    _tail = 0;
+  };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // PRODUCER
+  //
+  // returns false if full.
+  bool push(const T & value)
+  {
+    rb_index_t head = _head;
+    if ((rb_index_t)(head - _load(&_tail)) == N) return false;
+    _buffer[head & MASK] = value;
+    _store(&_head, head + 1);
+    return true;
+  };
+
+
+  // returns the number of values pushed, one barrier for all.
+  uint16_t push(const T * values, uint16_t n)
+  {
+    rb_index_t head = _head;
+    uint16_t space = N - (rb_index_t)(head - _load(&_tail));
+    if (n > space) n = space;
+    for (uint16_t i = 0; i < n; i++)
+    {
+      _buffer[(head + i) & MASK] = values[i];
+    }
+    _store(&_head, head + n);
+    return n;
+  };
+
+
+  uint16_t availableForWrite()  { return N - (rb_index_t)(_head - _load(&_tail)); };
+  bool     full()               { return availableForWrite() == 0; };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // CONSUMER
+  //
+  // returns false if empty.
+  bool pop(T & value)
+  {
+    rb_index_t tail = _tail;
+    if (_load(&_head) == tail) return false;
+    value = _buffer[tail & MASK];
+    _store(&_tail, tail + 1);
+    return true;
+  };
+
+
+  // returns the number of values popped, one barrier for all.
+  uint16_t pop(T * values, uint16_t n)
+  {
+    rb_index_t tail = _tail;
+    uint16_t count = (rb_index_t)(_load(&_head) - tail);
+    if (n > count) n = count;
+    for (uint16_t i = 0; i < n; i++)
+    {
+      values[i] = _buffer[(tail + i) & MASK];
+    }
+    _store(&_tail, tail + n);
+    return n;
+  };
+
+
+  bool peek(T & value)
+  {
+    rb_index_t tail = _tail;
+    if (_load(&_head) == tail) return false;
+    value = _buffer[tail & MASK];
+    return true;
+  };
+
+
+  uint16_t available()  { return (rb_index_t)(_load(&_head) - _tail); };
+  bool     empty()      { return available() == 0; };
+  // removes all values.
+  void     flush()      { _store(&_tail, _load(&_head)); };
+
+
+  /////////////////////////////////////////////////////////
+  //
+  // BOTH
+  //
+  uint16_t size()       { return N; };
+
+
+private:
+  static const rb_index_t MASK = N - 1;
+
+  static rb_index_t _load(rb_index_t * p)
+  {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+  };
+  static void _store(rb_index_t * p, rb_index_t value)
+  {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+  };
+
+  T           _buffer[N];
+  rb_index_t  _head;
+  rb_index_t  _tail;
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,72 @@
+//
+//    FILE: RingBuffer_isr.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: hand pulse timestamps from an interrupt to loop()
+//    DATE: 2021-09-18
+//     URL: https://github.com/RobTillaart/RingBuffer
+//
+// connect a pulse source e.g. a TSL235R to pin 2.
+// the ISR is the only producer, loop() the only consumer,
+// so no interrupts need to be disabled.
+
+
+#include "RingBuffer.h"
+
+
+RingBuffer<uint32_t, 64> pulses;
+volatile uint16_t overflow = 0;
+
+
+void pulseISR()
+{
+  if (pulses.push(micros()) == false) overflow++;
+}
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("RINGBUFFER_LIB_VERSION: ");
+  Serial.println(RINGBUFFER_LIB_VERSION);
+
+  pinMode(2, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(2), pulseISR, RISING);
+}
+
+
+uint32_t lastPrint = 0;
+uint32_t prev = 0;
+uint32_t count = 0;
+uint32_t sumPeriod = 0;
+
+
+void loop()
+{
+  // bulk pop, one barrier per batch.
+  uint32_t batch[16];
+  uint16_t n = pulses.pop(batch, 16);
+  for (uint16_t i = 0; i < n; i++)
+  {
+    if (prev != 0) sumPeriod += batch[i] - prev;
+    prev = batch[i];
+    count++;
+  }
+
+  if (millis() - lastPrint >= 1000)
+  {
+    lastPrint = millis();
+    Serial.print(count);
+    Serial.print("\t");
+    if (count > 1) Serial.print(sumPeriod * 1.0 / (count - 1), 1);
+    Serial.print(" us\t");
+    Serial.println(overflow);
+    count = 0;
+    sumPeriod = 0;
+    prev = 0;
+  }
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,73 @@
+//
+//    FILE: RingBuffer_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: time of push / pop, single and bulk
+//    DATE: 2021-09-18
+//     URL: https://github.com/RobTillaart/RingBuffer
+//
+
+
+#include "RingBuffer.h"
+
+
+RingBuffer<uint16_t, 64> rb;
+uint16_t data[32];
+
+uint32_t start, stop;
+volatile uint16_t x;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("RINGBUFFER_LIB_VERSION: ");
+  Serial.println(RINGBUFFER_LIB_VERSION);
+  Serial.println();
+
+  uint16_t v = 0;
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    rb.push(i);
+    rb.pop(v);
+  }
+  stop = micros();
+  x = v;
+  Serial.print("push + pop:\t\t");
+  Serial.print((stop - start) / 1000.0, 3);
+  Serial.println(" us");
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    for (int j = 0; j < 32; j++) rb.push(j);
+    for (int j = 0; j < 32; j++) rb.pop(data[j]);
+  }
+  stop = micros();
+  Serial.print("32 x push + pop:\t");
+  Serial.print((stop - start) / 32000.0, 3);
+  Serial.println(" us per value");
+
+  start = micros();
+  for (int i = 0; i < 1000; i++)
+  {
+    rb.push(data, 32);
+    rb.pop(data, 32);
+  }
+  stop = micros();
+  Serial.print("bulk 32 push + pop:\t");
+  Serial.print((stop - start) / 32000.0, 3);
+  Serial.println(" us per value");
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
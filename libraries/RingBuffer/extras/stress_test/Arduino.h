@@ -0,0 +1,11 @@
+#pragma once
+//
+//    FILE: Arduino.h
+// PURPOSE: minimal host replacement so RingBuffer.h compiles with g++
+//
+
+#include <stdint.h>
+
+#define F(s)    (s)
+
+// -- END OF FILE --
@@ -0,0 +1,121 @@
+//
+//    FILE: stress_test.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: host only producer / consumer test with two threads
+//    DATE: 2021-09-18
+//     URL: https://github.com/RobTillaart/RingBuffer
+//
+// the unit tests run in one thread, this test lets a second thread
+// preempt the producer / consumer anywhere.
+//
+// build and run on a PC (not an Arduino sketch):
+//   g++ -O2 -std=c++11 -pthread -I. -I../.. stress_test.cpp -o stress_test
+//   ./stress_test
+// add -fsanitize=thread to check for data races.
+//
+
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include "RingBuffer.h"
+
+
+const uint32_t COUNT = 2000000;
+
+RingBuffer<uint32_t, 64>   rb;
+RingBuffer<uint32_t, 1024> rb2;
+
+
+void producer()
+{
+  for (uint32_t i = 0; i < COUNT; )
+  {
+    if (rb.push(i)) i++;
+    else std::this_thread::yield();
+  }
+}
+
+
+// odd block size so blocks wrap around the end of the buffer.
+void producerBulk()
+{
+  uint32_t buf[37];
+  for (uint32_t i = 0; i < COUNT; )
+  {
+    uint16_t n = 0;
+    for (; (n < 37) && (i + n < COUNT); n++) buf[n] = i + n;
+    uint16_t k = rb2.push(buf, n);
+    if (k == 0) std::this_thread::yield();
+    i += k;
+  }
+}
+
+
+bool consumer()
+{
+  uint32_t expect = 0;
+  uint32_t value;
+  while (expect < COUNT)
+  {
+    if (rb.pop(value) == false)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    if (value != expect)
+    {
+      printf("single\tERROR got %u expected %u\n", value, expect);
+      return false;
+    }
+    expect++;
+  }
+  return true;
+}
+
+
+bool consumerBulk()
+{
+  uint32_t expect = 0;
+  uint32_t buf[50];
+  while (expect < COUNT)
+  {
+    uint16_t n = rb2.pop(buf, 50);
+    if (n == 0) std::this_thread::yield();
+    for (uint16_t i = 0; i < n; i++)
+    {
+      if (buf[i] != expect)
+      {
+        printf("bulk\tERROR got %u expected %u\n", buf[i], expect);
+        return false;
+      }
+      expect++;
+    }
+  }
+  return true;
+}
+
+
+int main()
+{
+  printf("RINGBUFFER_LIB_VERSION: %s\n\n", RINGBUFFER_LIB_VERSION);
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread p1(producer);
+  bool ok1 = consumer();
+  p1.join();
+  std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+  printf("single\t%s\t%.1f M values/s\n", ok1 ? "OK" : "FAIL", COUNT / duration.count() * 1e-6);
+
+  start = std::chrono::steady_clock::now();
+  std::thread p2(producerBulk);
+  bool ok2 = consumerBulk();
+  p2.join();
+  duration = std::chrono::steady_clock::now() - start;
+  printf("bulk\t%s\t%.1f M values/s\n", ok2 ? "OK" : "FAIL", COUNT / duration.count() * 1e-6);
+
+  return (ok1 && ok2) ? 0 : 1;
+}
+
+
+// -- END OF FILE --
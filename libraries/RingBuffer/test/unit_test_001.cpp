@@ -0,0 +1,143 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-18
+// PURPOSE: unit tests for the RingBuffer library
+//          https://github.com/RobTillaart/RingBuffer
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+
+
+#include <ArduinoUnitTests.h>
+
+#include "Arduino.h"
+#include "RingBuffer.h"
+
+
+unittest_setup()
+{
+  fprintf(stderr, "RINGBUFFER_LIB_VERSION: %s\n", (char *) RINGBUFFER_LIB_VERSION);
+}
+
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_constructor)
+{
+  RingBuffer<int, 8> rb;
+  assertEqual(8, rb.size());
+  assertEqual(0, rb.available());
+  assertEqual(8, rb.availableForWrite());
+  assertTrue(rb.empty());
+  assertFalse(rb.full());
+  int x = 42;
+  assertFalse(rb.pop(x));
+  assertFalse(rb.peek(x));
+  assertEqual(42, x);
+}
+
+
+unittest(test_push_pop)
+{
+  RingBuffer<int, 8> rb;
+  for (int i = 0; i < 8; i++) assertTrue(rb.push(i));
+  assertTrue(rb.full());
+  assertFalse(rb.push(100));
+  assertEqual(8, rb.available());
+
+  int x = -1;
+  assertTrue(rb.peek(x));
+  assertEqual(0, x);
+  for (int i = 0; i < 8; i++)
+  {
+    assertTrue(rb.pop(x));
+    assertEqual(i, x);
+  }
+  assertTrue(rb.empty());
+
+  // free running counters wrap many times
+  for (int i = 0; i < 100000; i++)
+  {
+    assertTrue(rb.push(i));
+    assertTrue(rb.push(i + 1));
+    assertTrue(rb.pop(x));
+    assertEqual(i, x);
+    assertTrue(rb.pop(x));
+    assertEqual(i + 1, x);
+  }
+  assertEqual(0, rb.available());
+
+  rb.push(1);
+  rb.push(2);
+  rb.flush();
+  assertTrue(rb.empty());
+  assertEqual(8, rb.availableForWrite());
+}
+
+
+unittest(test_bulk)
+{
+  RingBuffer<uint16_t, 16> rb;
+  uint16_t in[32], out[32];
+  for (int i = 0; i < 32; i++) in[i] = i * 3;
+
+  assertEqual(10, rb.push(in, 10));
+  assertEqual(6, rb.pop(out, 6));
+  // wraps around the end of the buffer
+  assertEqual(12, rb.push(in + 10, 20));
+  assertEqual(16, rb.available());
+  assertEqual(0, rb.push(in, 1));
+  assertEqual(16, rb.pop(out + 6, 20));
+  for (int i = 0; i < 22; i++) assertEqual(in[i], out[i]);
+  assertEqual(0, rb.pop(out, 4));
+}
+
+
+struct sample
+{
+  uint32_t time;
+  int16_t  value;
+};
+
+
+unittest(test_struct)
+{
+  RingBuffer<sample, 4> rb;
+  sample s = { 1000, -5 };
+  assertTrue(rb.push(s));
+  sample t = { 0, 0 };
+  assertTrue(rb.pop(t));
+  assertEqual(1000, t.time);
+  assertEqual(-5, t.value);
+}
+
+
+unittest_main()
+
+// --------
@@ -1,7 +1,7 @@
 //
 //    FILE: RunningAverage.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.4.0
+// VERSION: 0.4.1
 //    DATE: 2015-July-10
 // PURPOSE: Arduino library to calculate the running average by means of a circular buffer
 //     URL: https://github.com/RobTillaart/RunningAverage
@@ -36,6 +36,7 @@
 //  0.3.1   2020-06-19  fix library.json; minor refactor
 //  0.3.2   2021-01-15  add add() + license + refactor
 //  0.4.0   2021-05-18  increase size above 256 elements (16 bit version)
+//  0.4.1   2021-09-13  add RunningAverageBank, shared ring index for many channels
 
 #include "RunningAverage.h"
 
@@ -0,0 +1,142 @@
+//
+//    FILE: RunningAverageBank.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.4.1
+//    DATE: 2021-09-13
+// PURPOSE: running average of many synchronously sampled channels
+//     URL: https://github.com/RobTillaart/RunningAverage
+//
+// All channels share one ring index and count. The frames are stored
+// interleaved, a slot holds the values of all channels, so add() is
+// one straight loop over contiguous memory.
+
+
+#include "RunningAverageBank.h"
+
+
+RunningAverageBank::RunningAverageBank(const uint16_t channels, const uint16_t size)
+{
+  _channels = channels;
+  _size = size;
+  _sum = (float *) malloc((uint32_t)(_size + 1) * _channels * sizeof(float));
+  if (_sum == NULL)
+  {
+    _size = 0;
+    _channels = 0;
+  }
+  _array = _sum + _channels;
+  clear();
+}
+
+
+RunningAverageBank::~RunningAverageBank()
+{
+  if (_sum != NULL) free(_sum);
+}
+
+
+void RunningAverageBank::clear()
+{
+  _count = 0;
+  _index = 0;
+  uint32_t n = (uint32_t)(_size + 1) * _channels;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _sum[i] = 0.0;     // keeps add() simpler
+  }
+}
+
+
+void RunningAverageBank::add(const float * frame)
+{
+  if (_size == 0) return;
+
+  float * slot = &_array[(uint32_t)_index * _channels];
+  for (uint16_t ch = 0; ch < _channels; ch++)
+  {
+    _sum[ch] += frame[ch] - slot[ch];
+    slot[ch] = frame[ch];
+  }
+  _index++;
+  if (_index == _size) _index = 0;
+  if (_count < _size) _count++;
+}
+
+
+float RunningAverageBank::getAverage(const uint16_t channel) const
+{
+  if (_count == 0) return NAN;
+
+  float sum = 0;
+  const float * p = &_array[channel];
+  for (uint16_t i = 0; i < _count; i++)
+  {
+    sum += *p;
+    p += _channels;
+  }
+  return sum / _count;
+}
+
+
+float RunningAverageBank::getFastAverage(const uint16_t channel) const
+{
+  if (_count == 0) return NAN;
+  return _sum[channel] / _count;
+}
+
+
+void RunningAverageBank::getAverages(float * averages) const
+{
+  float f = (_count == 0) ? NAN : 1.0 / _count;
+  for (uint16_t ch = 0; ch < _channels; ch++)
+  {
+    averages[ch] = _sum[ch] * f;
+  }
+}
+
+
+float RunningAverageBank::getMinInBuffer(const uint16_t channel) const
+{
+  if (_count == 0) return NAN;
+
+  const float * p = &_array[channel];
+  float min = *p;
+  for (uint16_t i = 1; i < _count; i++)
+  {
+    p += _channels;
+    if (*p < min) min = *p;
+  }
+  return min;
+}
+
+
+float RunningAverageBank::getMaxInBuffer(const uint16_t channel) const
+{
+  if (_count == 0) return NAN;
+
+  const float * p = &_array[channel];
+  float max = *p;
+  for (uint16_t i = 1; i < _count; i++)
+  {
+    p += _channels;
+    if (*p > max) max = *p;
+  }
+  return max;
+}
+
+
+float RunningAverageBank::getValue(const uint16_t channel, const uint16_t idx) const
+{
+  if (idx >= _count) return NAN;
+
+  // the oldest is at _index when the buffer is full, at 0 otherwise
+  uint16_t pos = idx;
+  if (_count == _size)
+  {
+    pos += _index;
+    if (pos >= _size) pos -= _size;
+  }
+  return _array[(uint32_t)pos * _channels + channel];
+}
+
+// -- END OF FILE --
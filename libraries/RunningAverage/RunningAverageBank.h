@@ -0,0 +1,51 @@
+#pragma once
+//
+//    FILE: RunningAverageBank.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.4.1
+//    DATE: 2021-09-13
+// PURPOSE: running average of many synchronously sampled channels
+//     URL: https://github.com/RobTillaart/RunningAverage
+//
+// HISTORY: See RunningAverage.cpp
+
+
+#include "RunningAverage.h"
+
+
+class RunningAverageBank
+{
+public:
+  // one allocation for all channels, getSize() returns 0 if it failed.
+  RunningAverageBank(const uint16_t channels, const uint16_t size);
+  ~RunningAverageBank();
+
+  void     clear();
+  // frame = one value per channel
+  void     add(const float * frame);
+
+  float    getAverage(const uint16_t channel) const;      // iterates over all elements.
+  float    getFastAverage(const uint16_t channel) const;  // reuses the running sum.
+  // averages of all channels, uses the running sums.
+  void     getAverages(float * averages) const;
+
+  float    getMinInBuffer(const uint16_t channel) const;
+  float    getMaxInBuffer(const uint16_t channel) const;
+  // idx = 0 is the oldest
+  float    getValue(const uint16_t channel, const uint16_t idx) const;
+
+  bool     bufferIsFull() const  { return _count == _size; };
+  uint16_t getChannels() const   { return _channels; };
+  uint16_t getSize() const       { return _size; };
+  uint16_t getCount() const      { return _count; };
+
+protected:
+  uint16_t _channels;
+  uint16_t _size;
+  uint16_t _count;
+  uint16_t _index;       // shared ring index
+  float *  _sum;         // [channels]
+  float *  _array;       // [size][channels], one frame per slot
+};
+
+// -- END OF FILE --
@@ -0,0 +1,86 @@
+//
+//    FILE: ra_bank_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-13
+//
+// PUPROSE: memory and time per frame, 64 RunningAverage objects versus one RunningAverageBank
+//
+// needs > 4 KB RAM, e.g. MEGA, ESP32
+
+
+#include "RunningAverage.h"
+#include "RunningAverageBank.h"
+
+
+#define CHANNELS    64
+#define SIZE        8
+#define FRAMES      100
+
+
+float frame[CHANNELS];
+uint32_t start, stop;
+
+
+void setup(void)
+{
+  Serial.begin(115200);
+  Serial.print("\nPerformance RunningAverageBank: ");
+  Serial.println(RUNNINGAVERAGE_LIB_VERSION);
+  Serial.println();
+
+  for (int ch = 0; ch < CHANNELS; ch++) frame[ch] = random(1000);
+
+  // 64 objects, 64 allocations
+  RunningAverage * RA[CHANNELS];
+  for (int ch = 0; ch < CHANNELS; ch++) RA[ch] = new RunningAverage(SIZE);
+
+  start = micros();
+  for (int f = 0; f < FRAMES; f++)
+  {
+    for (int ch = 0; ch < CHANNELS; ch++) RA[ch]->addValue(frame[ch]);
+  }
+  stop = micros();
+  Serial.print("RunningAverage[]\t");
+  Serial.print((stop - start) / FRAMES);
+  Serial.print(" us/frame\t");
+  // heap overhead of every malloc not included.
+  Serial.print(CHANNELS * (sizeof(RunningAverage) + sizeof(RunningAverage *) + SIZE * sizeof(float)));
+  Serial.println(" bytes + 2 x 64 heap blocks");
+  for (int ch = 0; ch < CHANNELS; ch++) delete RA[ch];
+  delay(100);
+
+  // one allocation
+  RunningAverageBank bank(CHANNELS, SIZE);
+  start = micros();
+  for (int f = 0; f < FRAMES; f++)
+  {
+    bank.add(frame);
+  }
+  stop = micros();
+  Serial.print("RunningAverageBank\t");
+  Serial.print((stop - start) / FRAMES);
+  Serial.print(" us/frame\t");
+  Serial.print(sizeof(RunningAverageBank) + (SIZE + 1) * CHANNELS * sizeof(float));
+  Serial.println(" bytes + 1 heap block");
+  delay(100);
+
+  // averages of all channels
+  float avg[CHANNELS];
+  start = micros();
+  bank.getAverages(avg);
+  stop = micros();
+  Serial.print("getAverages()\t\t");
+  Serial.print(stop - start);
+  Serial.println(" us");
+
+  Serial.println("\ndone...\n");
+}
+
+
+void loop(void)
+{
+}
+
+
+// -- END OF FILE --
@@ -34,6 +34,7 @@
 
 #include "Arduino.h"
 #include "RunningAverage.h"
+#include "RunningAverageBank.h"
 
 
 unittest_setup()
@@ -141,6 +142,53 @@ unittest(test_partial)
 }
 
 
+unittest(test_bank)
+{
+  RunningAverageBank bank(64, 10);
+  RunningAverage RA[4] = { RunningAverage(10), RunningAverage(10), RunningAverage(10), RunningAverage(10) };
+  assertEqual(64, bank.getChannels());
+  assertEqual(10, bank.getSize());
+  assertEqual(0, bank.getCount());
+  assertNAN(bank.getAverage(0));
+
+  float frame[64];
+  for (int n = 0; n < 25; n++)
+  {
+    for (int ch = 0; ch < 64; ch++) frame[ch] = n * ch + (n % 3);
+    bank.add(frame);
+    for (int ch = 0; ch < 4; ch++) RA[ch].addValue(frame[ch]);
+    assertEqual(n < 10 ? n + 1 : 10, bank.getCount());
+  }
+  assertTrue(bank.bufferIsFull());
+
+  for (int ch = 0; ch < 4; ch++)
+  {
+    assertEqualFloat(RA[ch].getAverage(), bank.getAverage(ch), 0.001);
+    assertEqualFloat(RA[ch].getFastAverage(), bank.getFastAverage(ch), 0.001);
+    assertEqualFloat(RA[ch].getMinInBuffer(), bank.getMinInBuffer(ch), 0.001);
+    assertEqualFloat(RA[ch].getMaxInBuffer(), bank.getMaxInBuffer(ch), 0.001);
+    for (int i = 0; i < 10; i++)
+    {
+      assertEqualFloat(RA[ch].getValue(i), bank.getValue(ch, i), 0.001);
+    }
+  }
+  // channel 63 = 63 * (15..24) + n % 3
+  assertEqualFloat(63 * 19.5 + 0.9, bank.getAverage(63), 0.001);
+  assertEqualFloat(63 * 15, bank.getValue(63, 0), 0.001);
+
+  float avg[64];
+  bank.getAverages(avg);
+  for (int ch = 0; ch < 64; ch++)
+  {
+    assertEqualFloat(bank.getAverage(ch), avg[ch], 0.01);
+  }
+
+  bank.clear();
+  assertEqual(0, bank.getCount());
+  assertNAN(bank.getFastAverage(1));
+}
+
+
 unittest_main()
 
 // --------
@@ -1,7 +1,7 @@
 //
 //    FILE: RunningMedian.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.3.3
+// VERSION: 0.3.5
 // PURPOSE: RunningMedian library for Arduino
 //
 //  HISTORY:
@@ -29,6 +29,8 @@
 //  0.3.2   2021-01-21  replaced bubbleSort by insertionSort 
 //                      --> better performance for large arrays.
 //  0.3.3   2021-01-22  better insertionSort (+ cleanup test code)
+//  0.3.4   2021-09-13  add RunningMedianBank, shared ring index for many channels
+//  0.3.5   2021-09-14  add StaticRunningMedian<T, N>, sorting networks for N = 3, 5, 7, 9
 
 
 #include "RunningMedian.h"
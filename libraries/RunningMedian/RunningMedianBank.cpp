@@ -0,0 +1,180 @@
+//
+//    FILE: RunningMedianBank.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.3.4
+// PURPOSE: RunningMedian of many synchronously sampled channels
+//
+// All channels share one ring index and count, the frames are stored
+// interleaved in one allocation. The median of a channel is found by
+// copying its values to a scratch buffer and a quickselect,
+// O(n) on average instead of sorting.
+//
+
+
+#include "RunningMedianBank.h"
+
+
+RunningMedianBank::RunningMedianBank(const uint16_t channels, const uint8_t size)
+{
+  _channels = channels;
+  _size = size;
+  if (_size < MEDIAN_MIN_SIZE) _size = MEDIAN_MIN_SIZE;
+  _values = (float *) malloc(((uint32_t)_size * _channels + _size) * sizeof(float));
+  if (_values == NULL)
+  {
+    _size = 0;
+    _channels = 0;
+  }
+  _work = _values + (uint32_t)_size * _channels;
+  clear();
+}
+
+
+RunningMedianBank::~RunningMedianBank()
+{
+  free(_values);
+}
+
+
+void RunningMedianBank::clear()
+{
+  _count = 0;
+  _index = 0;
+}
+
+
+void RunningMedianBank::add(const float * frame)
+{
+  if (_size == 0) return;
+
+  float * slot = &_values[(uint32_t)_index * _channels];
+  for (uint16_t ch = 0; ch < _channels; ch++)
+  {
+    slot[ch] = frame[ch];
+  }
+  _index++;
+  if (_index >= _size) _index = 0;
+  if (_count < _size) _count++;
+}
+
+
+float RunningMedianBank::getMedian(const uint16_t channel)
+{
+  if (_count == 0) return NAN;
+
+  _gather(channel);
+  uint8_t mid = _count / 2;
+  float m = _select(mid);
+  if (_count & 0x01) return m;
+
+  // even count => average of the two middle elements,
+  // after the select all values below mid are <= m.
+  float low = _work[0];
+  for (uint8_t i = 1; i < mid; i++)
+  {
+    if (_work[i] > low) low = _work[i];
+  }
+  return (low + m) / 2;
+}
+
+
+void RunningMedianBank::getMedians(float * medians)
+{
+  for (uint16_t ch = 0; ch < _channels; ch++)
+  {
+    medians[ch] = getMedian(ch);
+  }
+}
+
+
+float RunningMedianBank::getHighest(const uint16_t channel)
+{
+  if (_count == 0) return NAN;
+
+  const float * p = &_values[channel];
+  float h = *p;
+  for (uint8_t i = 1; i < _count; i++)
+  {
+    p += _channels;
+    if (*p > h) h = *p;
+  }
+  return h;
+}
+
+
+float RunningMedianBank::getLowest(const uint16_t channel)
+{
+  if (_count == 0) return NAN;
+
+  const float * p = &_values[channel];
+  float l = *p;
+  for (uint8_t i = 1; i < _count; i++)
+  {
+    p += _channels;
+    if (*p < l) l = *p;
+  }
+  return l;
+}
+
+
+float RunningMedianBank::getAverage(const uint16_t channel)
+{
+  if (_count == 0) return NAN;
+
+  const float * p = &_values[channel];
+  float sum = 0;
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    sum += *p;
+    p += _channels;
+  }
+  return sum / _count;
+}
+
+
+/////////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+void RunningMedianBank::_gather(const uint16_t channel)
+{
+  const float * p = &_values[channel];
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    _work[i] = *p;
+    p += _channels;
+  }
+}
+
+
+// Hoare quickselect, returns the k-th smallest of _work[0.._count-1]
+float RunningMedianBank::_select(uint8_t k)
+{
+  int16_t left = 0;
+  int16_t right = _count - 1;
+  while (left < right)
+  {
+    float pivot = _work[(left + right) / 2];
+    int16_t i = left;
+    int16_t j = right;
+    while (i <= j)
+    {
+      while (_work[i] < pivot) i++;
+      while (_work[j] > pivot) j--;
+      if (i <= j)
+      {
+        float t = _work[i];
+        _work[i] = _work[j];
+        _work[j] = t;
+        i++;
+        j--;
+      }
+    }
+    if (k <= j) right = j;
+    else if (k >= i) left = i;
+    else break;
+  }
+  return _work[k];
+}
+
+// END OF FILE
@@ -0,0 +1,52 @@
+#pragma once
+//
+//    FILE: RunningMedianBank.h
+//  AUTHOR: Rob Tillaart
+// PURPOSE: RunningMedian of many synchronously sampled channels
+// VERSION: 0.3.4
+//     URL: https://github.com/RobTillaart/RunningMedian
+// HISTORY: See RunningMedian.cpp
+//
+
+
+#include "RunningMedian.h"
+
+
+class RunningMedianBank
+{
+public:
+  // one allocation for all channels, getSize() returns 0 if it failed.
+  RunningMedianBank(const uint16_t channels, const uint8_t size);
+  ~RunningMedianBank();
+
+  void     clear();
+  // frame = one value per channel
+  void     add(const float * frame);
+
+  // selection per channel, no sorting.
+  float    getMedian(const uint16_t channel);
+  // medians of all channels
+  void     getMedians(float * medians);
+  float    getHighest(const uint16_t channel);
+  float    getLowest(const uint16_t channel);
+  float    getAverage(const uint16_t channel);
+
+  uint16_t getChannels() { return _channels; };
+  uint8_t  getSize()     { return _size; };
+  uint8_t  getCount()    { return _count; };
+  bool     isFull()      { return (_count == _size); }
+
+
+protected:
+  uint16_t  _channels;
+  uint8_t   _size;
+  uint8_t   _count;
+  uint8_t   _index;     // shared ring index
+  float *   _values;    // [size][channels], one frame per slot
+  float *   _work;      // [size], scratch for the selection
+
+  void      _gather(const uint16_t channel);
+  float     _select(uint8_t k);
+};
+
+// END OF FILE
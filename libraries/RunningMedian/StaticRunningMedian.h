@@ -0,0 +1,196 @@
+#pragma once
+//
+//    FILE: StaticRunningMedian.h
+//  AUTHOR: Rob Tillaart
+// PURPOSE: RunningMedian template, static storage, compile time size
+// VERSION: 0.3.5
+//     URL: https://github.com/RobTillaart/RunningMedian
+// HISTORY: See RunningMedian.cpp
+//
+// T = float, int16_t, int32_t, ...
+// for even counts the median is (a + b) / 2, for integer types truncated.
+//
+
+
+#include "RunningMedian.h"
+
+
+// compare swap, a <= b afterwards
+#define RM_SORT2(a, b)    { if ((a) > (b)) { T t = (a); (a) = (b); (b) = t; } }
+
+
+template <typename T, uint16_t N>
+class StaticRunningMedian
+{
+public:
+  StaticRunningMedian()  { clear(); };
+
+  void     clear()
+  {
+    _count = 0;
+    _index = 0;
+  };
+
+  // adds a new value, replaces the oldest if full.
+  void     add(const T value)
+  {
+    _values[_index++] = value;
+    if (_index >= N) _index = 0;
+    if (_count < N) _count++;
+  };
+
+  // returns 0 if empty, T may have no NAN.
+  T        getMedian()
+  {
+    if (_count == 0) return 0;
+    if (_count == N)
+    {
+      // sorting networks, all branches but one are removed by the compiler.
+      if (N == 1) return _values[0];
+      if (N == 3) return _median3(_values);
+      if (N == 5) return _median5(_values);
+      if (N == 7) return _median7(_values);
+      if (N == 9) return _median9(_values);
+    }
+    for (uint16_t i = 0; i < _count; i++) _work[i] = _values[i];
+    uint16_t mid = _count / 2;
+    T m = _select(mid);
+    if (_count & 0x01) return m;
+    T low = _work[0];
+    for (uint16_t i = 1; i < mid; i++)
+    {
+      if (_work[i] > low) low = _work[i];
+    }
+    // low <= m, mixed signs cannot overflow the sum, equal signs the difference.
+    if ((low < 0) && (m >= 0)) return (low + m) / 2;
+    return low + (m - low) / 2;
+  };
+
+  T        getHighest()
+  {
+    if (_count == 0) return 0;
+    T h = _values[0];
+    for (uint16_t i = 1; i < _count; i++) if (_values[i] > h) h = _values[i];
+    return h;
+  };
+
+  T        getLowest()
+  {
+    if (_count == 0) return 0;
+    T l = _values[0];
+    for (uint16_t i = 1; i < _count; i++) if (_values[i] < l) l = _values[i];
+    return l;
+  };
+
+  float    getAverage()
+  {
+    if (_count == 0) return NAN;
+    float sum = 0;
+    for (uint16_t i = 0; i < _count; i++) sum += _values[i];
+    return sum / _count;
+  };
+
+  // get n'th element from the values in time order, 0 = oldest
+  T        getElement(const uint16_t n)
+  {
+    if (n >= _count) return 0;
+    uint16_t pos = n;
+    if (_count == N)
+    {
+      pos += _index;
+      if (pos >= N) pos -= N;
+    }
+    return _values[pos];
+  };
+
+  uint16_t getSize()   { return N; };
+  uint16_t getCount()  { return _count; };
+  bool     isFull()    { return (_count == N); };
+
+
+protected:
+  T        _values[N];
+  T        _work[N];
+  uint16_t _count;
+  uint16_t _index;
+
+
+  // Hoare quickselect on _work[0.._count-1]
+  T        _select(uint16_t k)
+  {
+    int16_t left = 0;
+    int16_t right = _count - 1;
+    while (left < right)
+    {
+      T pivot = _work[(left + right) / 2];
+      int16_t i = left;
+      int16_t j = right;
+      while (i <= j)
+      {
+        while (_work[i] < pivot) i++;
+        while (_work[j] > pivot) j--;
+        if (i <= j)
+        {
+          T t = _work[i];
+          _work[i] = _work[j];
+          _work[j] = t;
+          i++;
+          j--;
+        }
+      }
+      if ((int16_t)k <= j) right = j;
+      else if ((int16_t)k >= i) left = i;
+      else break;
+    }
+    return _work[k];
+  };
+
+
+  // median networks, v points to N values, see N. Devillard - Fast median search: an ANSI C implementation
+  T        _median3(const T * v)
+  {
+    T a = v[0], b = v[1], c = v[2];
+    RM_SORT2(a, b);
+    RM_SORT2(b, c);
+    RM_SORT2(a, b);
+    return b;
+  };
+
+  T        _median5(const T * v)
+  {
+    T p[5];
+    for (uint8_t i = 0; i < 5; i++) p[i] = v[i];
+    RM_SORT2(p[0], p[1]); RM_SORT2(p[3], p[4]); RM_SORT2(p[0], p[3]);
+    RM_SORT2(p[1], p[4]); RM_SORT2(p[1], p[2]); RM_SORT2(p[2], p[3]);
+    RM_SORT2(p[1], p[2]);
+    return p[2];
+  };
+
+  T        _median7(const T * v)
+  {
+    T p[7];
+    for (uint8_t i = 0; i < 7; i++) p[i] = v[i];
+    RM_SORT2(p[0], p[5]); RM_SORT2(p[0], p[3]); RM_SORT2(p[1], p[6]);
+    RM_SORT2(p[2], p[4]); RM_SORT2(p[0], p[1]); RM_SORT2(p[3], p[5]);
+    RM_SORT2(p[2], p[6]); RM_SORT2(p[2], p[3]); RM_SORT2(p[3], p[6]);
+    RM_SORT2(p[4], p[5]); RM_SORT2(p[1], p[4]); RM_SORT2(p[1], p[3]);
+    RM_SORT2(p[3], p[4]);
+    return p[3];
+  };
+
+  T        _median9(const T * v)
+  {
+    T p[9];
+    for (uint8_t i = 0; i < 9; i++) p[i] = v[i];
+    RM_SORT2(p[1], p[2]); RM_SORT2(p[4], p[5]); RM_SORT2(p[7], p[8]);
+    RM_SORT2(p[0], p[1]); RM_SORT2(p[3], p[4]); RM_SORT2(p[6], p[7]);
+    RM_SORT2(p[1], p[2]); RM_SORT2(p[4], p[5]); RM_SORT2(p[7], p[8]);
+    RM_SORT2(p[0], p[3]); RM_SORT2(p[5], p[8]); RM_SORT2(p[4], p[7]);
+    RM_SORT2(p[3], p[6]); RM_SORT2(p[1], p[4]); RM_SORT2(p[2], p[5]);
+    RM_SORT2(p[4], p[7]); RM_SORT2(p[4], p[2]); RM_SORT2(p[6], p[4]);
+    RM_SORT2(p[4], p[2]);
+    return p[4];
+  };
+};
+
+// END OF FILE
@@ -0,0 +1,93 @@
+//
+//    FILE: RunningMedianBank_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: memory and time per frame, 64 RunningMedian objects versus one RunningMedianBank
+//    DATE: 2021-09-13
+//     URL: https://github.com/RobTillaart/RunningMedian
+//
+// needs > 4 KB RAM, e.g. MEGA, ESP32
+
+
+#include "RunningMedian.h"
+#include "RunningMedianBank.h"
+
+
+#define CHANNELS    64
+#define SIZE        7
+#define FRAMES      20
+
+
+float frame[CHANNELS];
+float medians[CHANNELS];
+uint32_t start, stop;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.print("Running Median Bank Version: ");
+  Serial.println(RUNNING_MEDIAN_VERSION);
+  Serial.println();
+
+  // 64 objects, 128 allocations
+  RunningMedian * RM[CHANNELS];
+  for (int ch = 0; ch < CHANNELS; ch++) RM[ch] = new RunningMedian(SIZE);
+
+  uint32_t addTime = 0, medianTime = 0;
+  for (int f = 0; f < FRAMES; f++)
+  {
+    for (int ch = 0; ch < CHANNELS; ch++) frame[ch] = random(1000);
+    start = micros();
+    for (int ch = 0; ch < CHANNELS; ch++) RM[ch]->add(frame[ch]);
+    stop = micros();
+    addTime += stop - start;
+    start = micros();
+    for (int ch = 0; ch < CHANNELS; ch++) medians[ch] = RM[ch]->getMedian();
+    stop = micros();
+    medianTime += stop - start;
+  }
+  Serial.println("\t\t\tADD\tMEDIAN\tBYTES");
+  Serial.print("RunningMedian[]\t\t");
+  Serial.print(addTime / FRAMES);
+  Serial.print("\t");
+  Serial.print(medianTime / FRAMES);
+  Serial.print("\t");
+  // heap overhead of every malloc not included.
+  Serial.println(CHANNELS * (sizeof(RunningMedian) + sizeof(RunningMedian *) + SIZE * (sizeof(float) + 1)));
+  for (int ch = 0; ch < CHANNELS; ch++) delete RM[ch];
+  delay(100);
+
+  // one allocation
+  RunningMedianBank bank(CHANNELS, SIZE);
+  addTime = 0;
+  medianTime = 0;
+  for (int f = 0; f < FRAMES; f++)
+  {
+    for (int ch = 0; ch < CHANNELS; ch++) frame[ch] = random(1000);
+    start = micros();
+    bank.add(frame);
+    stop = micros();
+    addTime += stop - start;
+    start = micros();
+    bank.getMedians(medians);
+    stop = micros();
+    medianTime += stop - start;
+  }
+  Serial.print("RunningMedianBank\t");
+  Serial.print(addTime / FRAMES);
+  Serial.print("\t");
+  Serial.print(medianTime / FRAMES);
+  Serial.print("\t");
+  Serial.println(sizeof(RunningMedianBank) + (CHANNELS + 1) * SIZE * sizeof(float));
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
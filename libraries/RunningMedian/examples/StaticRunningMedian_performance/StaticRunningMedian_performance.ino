@@ -0,0 +1,125 @@
+//
+//    FILE: StaticRunningMedian_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: compare StaticRunningMedian<T, N> with RunningMedian per size and type
+//    DATE: 2021-09-14
+//     URL: https://github.com/RobTillaart/RunningMedian
+//
+
+
+#include "RunningMedian.h"
+#include "StaticRunningMedian.h"
+
+
+#define RUNS    500
+
+uint32_t start, stop;
+volatile float f;
+volatile int32_t x;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.print("Running Median Version: ");
+  Serial.println(RUNNING_MEDIAN_VERSION);
+  Serial.println();
+  Serial.println("N\tclass\tfloat\tint16\tint32\t(us per add + getMedian)");
+
+  bench<3>();
+  bench<5>();
+  bench<7>();
+  bench<9>();
+  bench<15>();
+  bench<25>();
+
+  Serial.println();
+  Serial.println("N\tclass\tfloat\tint16\tint32\t(bytes)");
+  memory<5>();
+  memory<9>();
+  memory<25>();
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+template <uint16_t N>
+void bench()
+{
+  RunningMedian RM(N);
+  StaticRunningMedian<float, N>   SRMF;
+  StaticRunningMedian<int16_t, N> SRM16;
+  StaticRunningMedian<int32_t, N> SRM32;
+
+  Serial.print(N);
+  Serial.print("\t");
+
+  randomSeed(1);
+  start = micros();
+  for (int i = 0; i < RUNS; i++)
+  {
+    RM.add(random(1000));
+    f = RM.getMedian();
+  }
+  stop = micros();
+  Serial.print(1.0 * (stop - start) / RUNS, 1);
+  Serial.print("\t");
+
+  randomSeed(1);
+  start = micros();
+  for (int i = 0; i < RUNS; i++)
+  {
+    SRMF.add(random(1000));
+    f = SRMF.getMedian();
+  }
+  stop = micros();
+  Serial.print(1.0 * (stop - start) / RUNS, 1);
+  Serial.print("\t");
+
+  randomSeed(1);
+  start = micros();
+  for (int i = 0; i < RUNS; i++)
+  {
+    SRM16.add(random(1000));
+    x = SRM16.getMedian();
+  }
+  stop = micros();
+  Serial.print(1.0 * (stop - start) / RUNS, 1);
+  Serial.print("\t");
+
+  randomSeed(1);
+  start = micros();
+  for (int i = 0; i < RUNS; i++)
+  {
+    SRM32.add(random(1000));
+    x = SRM32.getMedian();
+  }
+  stop = micros();
+  Serial.println(1.0 * (stop - start) / RUNS, 1);
+  delay(100);
+}
+
+
+template <uint16_t N>
+void memory()
+{
+  Serial.print(N);
+  Serial.print("\t");
+  // class + two mallocs (heap overhead not included)
+  Serial.print(sizeof(RunningMedian) + N * (sizeof(float) + 1));
+  Serial.print("\t");
+  Serial.print(sizeof(StaticRunningMedian<float, N>));
+  Serial.print("\t");
+  Serial.print(sizeof(StaticRunningMedian<int16_t, N>));
+  Serial.print("\t");
+  Serial.println(sizeof(StaticRunningMedian<int32_t, N>));
+}
+
+
+// -- END OF FILE --
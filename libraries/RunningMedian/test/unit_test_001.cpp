@@ -34,6 +34,8 @@
 
 #include "Arduino.h"
 #include "RunningMedian.h"
+#include "RunningMedianBank.h"
+#include "StaticRunningMedian.h"
 
 
 
@@ -118,6 +120,155 @@ unittest(test_big)
 }
 
 
+unittest(test_bank)
+{
+  RunningMedianBank bank(64, 7);
+  assertEqual(64, bank.getChannels());
+  assertEqual(7, bank.getSize());
+  assertEqual(0, bank.getCount());
+  assertNAN(bank.getMedian(0));
+
+  RunningMedian RM(7);
+  float frame[64];
+  for (int n = 0; n < 20; n++)
+  {
+    for (int ch = 0; ch < 64; ch++) frame[ch] = ((n * 37 + ch * 11) % 23) - 5;
+    bank.add(frame);
+    RM.add(frame[5]);
+    // odd and even counts
+    assertEqualFloat(RM.getMedian(), bank.getMedian(5), 0.0001);
+  }
+  assertTrue(bank.isFull());
+  assertEqualFloat(RM.getHighest(), bank.getHighest(5), 0.0001);
+  assertEqualFloat(RM.getLowest(),  bank.getLowest(5),  0.0001);
+  assertEqualFloat(RM.getAverage(), bank.getAverage(5), 0.0001);
+
+  // duplicates
+  RunningMedianBank bank2(2, 6);
+  float values[6] = { 3, 3, 1, 3, 9, 1 };
+  for (int i = 0; i < 6; i++)
+  {
+    frame[0] = values[i];
+    frame[1] = -values[i];
+    bank2.add(frame);
+  }
+  float medians[2];
+  bank2.getMedians(medians);
+  assertEqualFloat(3, medians[0], 0.0001);
+  assertEqualFloat(-3, medians[1], 0.0001);
+
+  bank.clear();
+  assertEqual(0, bank.getCount());
+}
+
+
+// 0-1 principle, a network is correct if it is correct for all 0/1 inputs.
+template <uint16_t N>
+bool checkNetwork()
+{
+  StaticRunningMedian<int16_t, N> SRM;
+  for (uint16_t bits = 0; bits < (1 << N); bits++)
+  {
+    int ones = 0;
+    for (uint16_t i = 0; i < N; i++)
+    {
+      int16_t b = (bits >> i) & 1;
+      ones += b;
+      SRM.add(b);
+    }
+    if (SRM.getMedian() != ((ones > N / 2) ? 1 : 0)) return false;
+  }
+  return true;
+}
+
+
+unittest(test_static_networks)
+{
+  assertTrue(checkNetwork<3>());
+  assertTrue(checkNetwork<5>());
+  assertTrue(checkNetwork<7>());
+  assertTrue(checkNetwork<9>());
+}
+
+
+unittest(test_static_versus_class)
+{
+  RunningMedian RM(11);
+  StaticRunningMedian<float, 11> SRM;
+  StaticRunningMedian<float, 7>  SRM7;
+  RunningMedian RM7(7);
+  assertEqual(11, SRM.getSize());
+  assertEqual(0, SRM.getCount());
+  assertFalse(SRM.isFull());
+
+  for (int n = 0; n < 40; n++)
+  {
+    float v = ((n * 37) % 19) - 9.5;
+    RM.add(v);
+    SRM.add(v);
+    RM7.add(v);
+    SRM7.add(v);
+    assertEqualFloat(RM.getMedian(),  SRM.getMedian(),  0.0001);
+    assertEqualFloat(RM7.getMedian(), SRM7.getMedian(), 0.0001);
+  }
+  assertTrue(SRM.isFull());
+  assertEqualFloat(RM.getHighest(), SRM.getHighest(), 0.0001);
+  assertEqualFloat(RM.getLowest(),  SRM.getLowest(),  0.0001);
+  assertEqualFloat(RM.getAverage(), SRM.getAverage(), 0.0001);
+  for (int i = 0; i < 11; i++)
+  {
+    assertEqualFloat(RM.getElement(i), SRM.getElement(i), 0.0001);
+  }
+}
+
+
+unittest(test_static_integer)
+{
+  StaticRunningMedian<int16_t, 5> SRM16;
+  StaticRunningMedian<int32_t, 4> SRM32;
+  fprintf(stderr, "sizeof int16 5: %d\n", (int)sizeof(SRM16));
+  assertEqual(0, SRM16.getMedian());
+
+  SRM16.add(-300);
+  SRM16.add(1200);
+  SRM16.add(7);
+  assertEqual(7, SRM16.getMedian());
+  SRM16.add(32000);
+  SRM16.add(-32000);
+  assertEqual(7, SRM16.getMedian());
+  SRM16.add(100);     // replaces -300
+  assertEqual(100, SRM16.getMedian());
+  assertEqual(32000, SRM16.getHighest());
+  assertEqual(-32000, SRM16.getLowest());
+  assertEqual(1200, SRM16.getElement(0));
+
+  // exact, no float rounding
+  SRM32.add(100000001L);
+  SRM32.add(100000003L);
+  SRM32.add(5);
+  assertEqual(100000001L, SRM32.getMedian());
+  SRM32.add(7);
+  assertEqual(50000004L, SRM32.getMedian());     // (7 + 100000001) / 2
+
+  // even count at the limits, low + m would overflow
+  SRM32.clear();
+  for (int i = 0; i < 4; i++) SRM32.add(2000000000L);
+  assertEqual(2000000000L, SRM32.getMedian());
+  SRM32.clear();
+  for (int i = 0; i < 4; i++) SRM32.add(-2000000000L);
+  assertEqual(-2000000000L, SRM32.getMedian());
+  SRM32.add(2147483645L);
+  SRM32.add(2147483645L);
+  assertEqual(73741822L, SRM32.getMedian());     // m - low would overflow
+  SRM32.add(2147483647L);
+  SRM32.add(2147483647L);
+  assertEqual(2147483646L, SRM32.getMedian());
+
+  SRM32.clear();
+  assertEqual(0, SRM32.getCount());
+}
+
+
 unittest_main()
 
 // --------
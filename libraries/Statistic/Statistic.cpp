@@ -2,7 +2,7 @@
 //    FILE: Statistic.cpp
 //  AUTHOR: Rob dot Tillaart at gmail dot com
 //          modified at 0.3 by Gil Ross at physics dot org
-// VERSION: 0.4.3
+// VERSION: 0.4.4
 // PURPOSE: Recursive statistical library for Arduino
 //
 // NOTE: 2011-01-07 Gill Ross
@@ -55,6 +55,7 @@
 //  0.4.1   2020-06-19  fix library.json
 //  0.4.2   2021-01-08  add Arduino-CI + unit tests
 //  0.4.3   2021-01-20  add() returns how much was actually added.
+//  0.4.4   2021-09-12  add StatisticBank, struct of arrays for many channels.
 
 
 #include "Statistic.h"
@@ -3,7 +3,7 @@
 //    FILE: Statistic.h
 //  AUTHOR: Rob dot Tillaart at gmail dot com
 //          modified at 0.3 by Gil Ross at physics dot org
-// VERSION: 0.4.3
+// VERSION: 0.4.4
 // PURPOSE: Recursive Statistical library for Arduino
 // HISTORY: See Statistic.cpp
 //
@@ -13,7 +13,7 @@
 #include <math.h>
 
 
-#define STATISTIC_LIB_VERSION       (F("0.4.3"))
+#define STATISTIC_LIB_VERSION       (F("0.4.4"))
 
 class Statistic
 {
@@ -0,0 +1,140 @@
+//
+//    FILE: StatisticBank.cpp
+//  AUTHOR: Rob dot Tillaart at gmail dot com
+// VERSION: 0.4.4
+// PURPOSE: Statistic for many channels, struct of arrays layout
+//
+// Every field has its own array so add() is a straight loop over
+// the channels without branches, which compilers can vectorize.
+// The count is shared, so 1/count is calculated once per frame.
+// The running mean and sum of squares differences are updated
+// with the Welford recurrence, numerically equivalent to Statistic.
+//
+
+
+#include "StatisticBank.h"
+
+
+StatisticBank::StatisticBank(uint16_t channels, bool useStdDev)
+{
+  _channels = channels;
+  uint8_t * p = (uint8_t *) malloc(channels * (4 * sizeof(float) + 1));
+  if (p == NULL) _channels = 0;
+  _mean   = (float *) p;
+  _min    = _mean + channels;
+  _max    = _min + channels;
+  _ssqdif = _max + channels;
+  _flag   = (uint8_t *)(_ssqdif + channels);
+  _threshold = STATISTICBANK_DEFAULT_THRESHOLD;
+  _warmup    = STATISTICBANK_DEFAULT_WARMUP;
+  clear(useStdDev);
+}
+
+
+StatisticBank::~StatisticBank()
+{
+  free(_mean);
+}
+
+
+void StatisticBank::clear(bool useStdDev)
+{
+  _cnt = 0;
+  _useStdDev = useStdDev;
+  _anomalies = 0;
+  for (uint16_t i = 0; i < _channels; i++)
+  {
+    _mean[i]   = 0;
+    _min[i]    = 0;
+    _max[i]    = 0;
+    _ssqdif[i] = 0;
+    _flag[i]   = 0;
+  }
+}
+
+
+uint16_t StatisticBank::add(const float * frame)
+{
+  uint16_t n = _channels;
+  if (_cnt == 0)
+  {
+    for (uint16_t i = 0; i < n; i++)
+    {
+      _mean[i] = frame[i];
+      _min[i]  = frame[i];
+      _max[i]  = frame[i];
+      _flag[i] = 0;
+    }
+    _cnt = 1;
+    _anomalies = 0;
+    return 0;
+  }
+
+  for (uint16_t i = 0; i < n; i++)
+  {
+    float v = frame[i];
+    _min[i] = (v < _min[i]) ? v : _min[i];
+    _max[i] = (v > _max[i]) ? v : _max[i];
+  }
+
+  _cnt++;
+  float invCnt = 1.0 / _cnt;
+  if (_useStdDev == false)
+  {
+    for (uint16_t i = 0; i < n; i++)
+    {
+      _mean[i] += (frame[i] - _mean[i]) * invCnt;
+    }
+    return 0;
+  }
+
+  // z^2 > threshold^2 * variance, no sqrt or division per channel.
+  // variance is of the previous frames, the count of those is _cnt - 1.
+  bool check = (_cnt > _warmup);
+  float limit = check ? _threshold * _threshold / (_cnt - 1) : 0;
+  uint16_t anomalies = 0;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    float delta = frame[i] - _mean[i];
+    uint8_t f = check && (delta * delta > limit * _ssqdif[i]);
+    _flag[i] = f;
+    anomalies += f;
+    _mean[i] += delta * invCnt;
+    _ssqdif[i] += delta * (frame[i] - _mean[i]);
+  }
+  _anomalies = anomalies;
+  return anomalies;
+}
+
+
+float StatisticBank::average(uint16_t ch) const
+{
+  if (_cnt == 0) return NAN;
+  return _mean[ch];
+}
+
+
+float StatisticBank::variance(uint16_t ch) const
+{
+  if (!_useStdDev) return NAN;
+  if (_cnt == 0) return NAN;
+  return _ssqdif[ch] / _cnt;
+}
+
+
+float StatisticBank::pop_stdev(uint16_t ch) const
+{
+  if (!_useStdDev) return NAN;
+  if (_cnt == 0) return NAN;
+  return sqrt(_ssqdif[ch] / _cnt);
+}
+
+
+float StatisticBank::unbiased_stdev(uint16_t ch) const
+{
+  if (!_useStdDev) return NAN;
+  if (_cnt < 2) return NAN;
+  return sqrt(_ssqdif[ch] / (_cnt - 1));
+}
+
+// -- END OF FILE --
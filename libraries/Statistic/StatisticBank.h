@@ -0,0 +1,73 @@
+#pragma once
+//
+//    FILE: StatisticBank.h
+//  AUTHOR: Rob dot Tillaart at gmail dot com
+// VERSION: 0.4.4
+// PURPOSE: Statistic for many channels, struct of arrays layout
+// HISTORY: See Statistic.cpp
+//
+
+
+#include "Statistic.h"
+
+
+#define STATISTICBANK_DEFAULT_THRESHOLD     3.0
+#define STATISTICBANK_DEFAULT_WARMUP        10
+
+
+class StatisticBank
+{
+public:
+  // channels() returns 0 if allocation failed.
+  StatisticBank(uint16_t channels, bool useStdDev = true);
+  ~StatisticBank();
+
+  void     clear(bool useStdDev = true);
+  uint16_t channels() const  { return _channels; };
+
+  // frame = one value per channel.
+  // returns the number of channels flagged as anomaly.
+  uint16_t add(const float * frame);
+
+
+  // all channels have the same count
+  uint32_t count() const     { return _cnt; };
+  float    sum(uint16_t ch) const      { return _mean[ch] * _cnt; };
+  float    minimum(uint16_t ch) const  { return _min[ch]; };
+  float    maximum(uint16_t ch) const  { return _max[ch]; };
+  float    average(uint16_t ch) const;
+
+  // useStdDev must be true to use next three
+  float    variance(uint16_t ch) const;
+  float    pop_stdev(uint16_t ch) const;
+  float    unbiased_stdev(uint16_t ch) const;
+
+
+  // anomaly = | value - average | > threshold * pop_stdev, before the value is added.
+  // only checked after warmup frames and if useStdDev == true.
+  void     setThreshold(float z)     { _threshold = z; };
+  float    getThreshold() const      { return _threshold; };
+  void     setWarmup(uint32_t count) { _warmup = count; };
+  uint32_t getWarmup() const         { return _warmup; };
+  // flags of the last frame
+  bool     isAnomaly(uint16_t ch) const  { return _flag[ch] != 0; };
+  uint16_t anomalies() const         { return _anomalies; };
+
+
+protected:
+  uint16_t _channels;
+  uint32_t _cnt;
+  bool     _useStdDev;
+  float    _threshold;
+  uint32_t _warmup;
+  uint16_t _anomalies;
+
+  // one allocation, split in arrays
+  float *   _mean;
+  float *   _min;
+  float *   _max;
+  float *   _ssqdif;
+  uint8_t * _flag;
+};
+
+// -- END OF FILE --
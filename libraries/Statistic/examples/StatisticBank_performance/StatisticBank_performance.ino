@@ -0,0 +1,93 @@
+//
+//    FILE: StatisticBank_performance.ino
+//  AUTHOR: Rob dot Tillaart at gmail dot com
+// VERSION: 0.1.0
+// PURPOSE: compare StatisticBank with an array of Statistic objects
+//    DATE: 2021-09-12
+//
+// UNO has only 2 KB RAM so CHANNELS is small, use an ESP32 for 1000+ channels.
+
+
+#include "Statistic.h"
+#include "StatisticBank.h"
+
+
+#if defined(ESP32) || defined(ESP8266)
+#define CHANNELS    1000
+#else
+#define CHANNELS    32
+#endif
+
+#define FRAMES      100
+
+
+Statistic stats[CHANNELS];
+StatisticBank bank(CHANNELS);
+float frame[CHANNELS];
+
+uint32_t start, stop;
+
+
+void setup(void)
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("STATISTIC_LIB_VERSION: ");
+  Serial.println(STATISTIC_LIB_VERSION);
+  Serial.print("CHANNELS: ");
+  Serial.println(bank.channels());
+  Serial.println();
+
+  for (int ch = 0; ch < CHANNELS; ch++) frame[ch] = random(1000) * 0.01;
+
+  start = micros();
+  for (int f = 0; f < FRAMES; f++)
+  {
+    frame[f % CHANNELS] += 0.1;
+    for (int ch = 0; ch < CHANNELS; ch++) stats[ch].add(frame[ch]);
+  }
+  stop = micros();
+  uint32_t t1 = stop - start;
+  report("Statistic[]", t1);
+
+  start = micros();
+  for (int f = 0; f < FRAMES; f++)
+  {
+    frame[f % CHANNELS] -= 0.1;
+    bank.add(frame);
+  }
+  stop = micros();
+  uint32_t t2 = stop - start;
+  report("StatisticBank", t2);
+
+  Serial.print("FACTOR:\t\t");
+  Serial.println(1.0 * t1 / t2, 2);
+
+  // memory per channel
+  Serial.print("BYTES/CH:\t");
+  Serial.print(sizeof(Statistic));
+  Serial.print("\t");
+  Serial.println(4 * sizeof(float) + 1);
+
+  Serial.println("\ndone...");
+}
+
+
+void loop(void)
+{
+}
+
+
+void report(const char * name, uint32_t duration)
+{
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(duration);
+  Serial.print(" us\t");
+  Serial.print(1e6 * FRAMES * CHANNELS / duration, 0);
+  Serial.println(" values/sec");
+  delay(100);
+}
+
+
+// -- END OF FILE --
@@ -34,6 +34,7 @@
 
 #include "Arduino.h"
 #include "Statistic.h"
+#include "StatisticBank.h"
 
 
 unittest_setup()
@@ -86,6 +87,89 @@ unittest(test_basic)
 
 
 
+unittest(test_bank_equals_statistic)
+{
+  StatisticBank bank(8);
+  Statistic stats[8];
+  assertEqual(8, bank.channels());
+  assertEqual(0, bank.count());
+  assertNAN(bank.average(0));
+
+  float frame[8];
+  for (int n = 1; n < 100; n++)
+  {
+    for (int ch = 0; ch < 8; ch++)
+    {
+      frame[ch] = n * (ch + 1) + ch;
+      stats[ch].add(frame[ch]);
+    }
+    bank.add(frame);
+  }
+  assertEqual(99, bank.count());
+  for (int ch = 0; ch < 8; ch++)
+  {
+    float eps = 0.0001 * (ch + 1) * (ch + 1);
+    assertEqualFloat(stats[ch].sum(),       bank.sum(ch),       0.01 * (ch + 1));
+    assertEqualFloat(stats[ch].minimum(),   bank.minimum(ch),   0.0001);
+    assertEqualFloat(stats[ch].maximum(),   bank.maximum(ch),   0.0001);
+    assertEqualFloat(stats[ch].average(),   bank.average(ch),   0.0001 * (ch + 1));
+    assertEqualFloat(stats[ch].variance(),  bank.variance(ch),  1000 * eps);
+    assertEqualFloat(stats[ch].pop_stdev(), bank.pop_stdev(ch), 0.001 * (ch + 1));
+    assertEqualFloat(stats[ch].unbiased_stdev(), bank.unbiased_stdev(ch), 0.001 * (ch + 1));
+  }
+  // channel 0 = 1..99
+  assertEqualFloat(816.667, bank.variance(0), 0.01);
+
+  bank.clear();
+  assertEqual(0, bank.count());
+  assertEqualFloat(0, bank.sum(3), 0.0001);
+}
+
+
+unittest(test_bank_anomaly)
+{
+  StatisticBank bank(4);
+  assertEqualFloat(STATISTICBANK_DEFAULT_THRESHOLD, bank.getThreshold(), 0.0001);
+  assertEqual(STATISTICBANK_DEFAULT_WARMUP, bank.getWarmup());
+  bank.setThreshold(4);
+  bank.setWarmup(20);
+  assertEqualFloat(4, bank.getThreshold(), 0.0001);
+  assertEqual(20, bank.getWarmup());
+
+  // alternating 9 / 11 => average 10, stdev 1
+  float frame[4];
+  for (int n = 0; n < 100; n++)
+  {
+    for (int ch = 0; ch < 4; ch++) frame[ch] = (n & 1) ? 11 : 9;
+    assertEqual(0, bank.add(frame));
+  }
+  frame[1] = 14.5;    //  z = 4.5
+  frame[2] = 6.5;     //  z = -3.5
+  frame[3] = 5.5;     //  z = -4.5
+  assertEqual(2, bank.add(frame));
+  assertEqual(2, bank.anomalies());
+  assertFalse(bank.isAnomaly(0));
+  assertTrue(bank.isAnomaly(1));
+  assertFalse(bank.isAnomaly(2));
+  assertTrue(bank.isAnomaly(3));
+
+  // no flags during warmup
+  bank.clear();
+  frame[0] = 0;
+  bank.add(frame);
+  frame[0] = 1000;
+  assertEqual(0, bank.add(frame));
+
+  // no stdev, no flags
+  bank.clear(false);
+  for (int n = 0; n < 100; n++) bank.add(frame);
+  frame[0] = -1000;
+  assertEqual(0, bank.add(frame));
+  assertNAN(bank.variance(0));
+  assertEqualFloat(980.198, bank.average(0), 0.001);
+}
+
+
 unittest_main()
 
 // --------
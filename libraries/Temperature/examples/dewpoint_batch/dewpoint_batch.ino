@@ -0,0 +1,92 @@
+//
+//    FILE: dewpoint_batch.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: performance of the array functions per accuracy tier
+//    DATE: 2021-09-20
+
+
+#include "temperature.h"
+
+
+#define SAMPLES     50
+
+float celsius[SAMPLES];
+float humidity[SAMPLES];
+float dewpoint[SAMPLES];
+float out[SAMPLES];
+
+uint32_t start, duration;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("TEMPERATURE_VERSION: ");
+  Serial.println(TEMPERATURE_VERSION);
+  Serial.println();
+
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    celsius[i]  = 15 + random(150) * 0.1;
+    humidity[i] = 20 + random(80);
+  }
+
+  const char * names[3] = { "EXACT", "MAGNUS", "POLY" };
+  for (uint8_t acc = TEMPERATURE_EXACT; acc <= TEMPERATURE_POLY; acc++)
+  {
+    delay(10);
+    start = micros();
+    dewPoint_n(celsius, humidity, out, SAMPLES, acc);
+    duration = micros() - start;
+    Serial.print("dewPoint_n\t");
+    Serial.print(names[acc]);
+    Serial.print("\t");
+    Serial.println(1.0 * duration / SAMPLES, 2);
+  }
+
+  dewPoint_n(celsius, humidity, dewpoint, SAMPLES);
+  for (uint8_t acc = TEMPERATURE_EXACT; acc <= TEMPERATURE_POLY; acc += 2)
+  {
+    delay(10);
+    start = micros();
+    humidex_n(celsius, dewpoint, out, SAMPLES, acc);
+    duration = micros() - start;
+    Serial.print("humidex_n\t");
+    Serial.print(names[acc]);
+    Serial.print("\t");
+    Serial.println(1.0 * duration / SAMPLES, 2);
+  }
+
+  delay(10);
+  start = micros();
+  heatIndexC_n(celsius, humidity, out, SAMPLES);
+  duration = micros() - start;
+  Serial.print("heatIndexC_n\t\t");
+  Serial.println(1.0 * duration / SAMPLES, 2);
+  Serial.println("(us per sample)\n");
+
+  // accuracy
+  float maxError = 0;
+  for (int cel = -20; cel <= 50; cel++)
+  {
+    for (int hum = 1; hum <= 100; hum++)
+    {
+      float x = abs(dewPoint(cel, hum) - dewPointPoly(cel, hum));
+      if (x > maxError) maxError = x;
+    }
+  }
+  Serial.print("dewPointPoly() max error:\t");
+  Serial.println(maxError, 3);
+
+  Serial.println("\nDone...");
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
@@ -1,7 +1,7 @@
 #pragma once
 //
 //    FILE: temperature.h
-// VERSION: 0.2.4
+// VERSION: 0.2.5
 // PURPOSE: temperature functions
 //
 //  HISTORY:
@@ -14,9 +14,17 @@
 //  0.2.2   2020-06-19  fix library.json
 //  0.2.3   2020-08-27  fix #5 order of functions, typo, fixed 1 example
 //  0.2.4   2021-01-08  Arduino-CI + unit tests
+//  0.2.5   2021-09-20  added dewPointPoly(), humidexFast() and array versions
+//                      dewPoint_n(), humidex_n(), heatIndexC_n()
 
 
-#define TEMPERATURE_VERSION     (F("0.2.4"))
+#define TEMPERATURE_VERSION     (F("0.2.5"))
+
+
+// accuracy tiers for the array functions
+#define TEMPERATURE_EXACT       0
+#define TEMPERATURE_MAGNUS      1
+#define TEMPERATURE_POLY        2
 
 
 inline float Fahrenheit(float celsius)
@@ -76,6 +84,68 @@ float dewPointFast(float celsius, float humidity)
 }
 
 
+// ln(x) x > 0,  x = m * 2^e,  m in [0.707 .. 1.414)
+// f suffix keeps the math in float, double is software emulated on e.g. ESP32.
+// the IEEE754 exponent is taken from the bits, no frexp() or division,
+// ln(m) = Chebyshev fit of degree 6, max absolute error ~1.5e-6
+float _temperatureLn(float x)
+{
+  uint32_t bits;
+  memcpy(&bits, &x, 4);
+  int e = ((bits >> 23) & 0xFF) - 127;
+  bits = (bits & 0x007FFFFF) | 0x3F800000;     // m in [1 .. 2)
+  float m;
+  memcpy(&m, &bits, 4);
+  if (m > 1.41421356f)
+  {
+    m *= 0.5f;
+    e++;
+  }
+  float u = m - 1;
+  float p = -0.13931262f;
+  p = p * u + 0.22294995f;
+  p = p * u - 0.25564771f;
+  p = p * u + 0.33228942f;
+  p = p * u - 0.49978617f;
+  p = p * u + 1.00001303f;
+  p = p * u - 1.10429866e-6f;
+  return p + e * 0.69314718f;
+}
+
+
+// exp(x) = 2^i * 2^f,  |f| <= 0.5,  valid for |x| < 87
+// 2^i is added to the IEEE754 exponent bits, no ldexp()
+// 2^f = Chebyshev fit of degree 5, max relative error ~1e-7
+float _temperatureExp(float x)
+{
+  float y = x * 1.44269504f;     // log2(e)
+  int i = (y < 0) ? y - 0.5f : y + 0.5f;
+  float f = y - i;
+  float p = 0.00134004322f;
+  p = p * f + 0.0096760371f;
+  p = p * f + 0.0555032721f;
+  p = p * f + 0.240221074f;
+  p = p * f + 0.693147207f;
+  p = p * f + 1.00000008f;
+  uint32_t bits;
+  memcpy(&bits, &p, 4);
+  bits += (uint32_t)i << 23;     // unsigned wrap handles i < 0
+  memcpy(&p, &bits, 4);
+  return p;
+}
+
+
+// dewPointFast() with a polynomial ln(), no math library calls.
+// delta with dewPointFast() < 0.001
+float dewPointPoly(float celsius, float humidity)
+{
+  float a = 17.271f;
+  float b = 237.7f;
+  float temp = (a * celsius) / (b + celsius) + _temperatureLn(humidity * 0.01f);
+  return (b * temp) / (a - temp);
+}
+
+
 // https://en.wikipedia.org/wiki/Humidex
 float humidex(float celsius, float DewPoint)
 {
@@ -85,6 +155,14 @@ float humidex(float celsius, float DewPoint)
 }
 
 
+// humidex() with a polynomial exp(), delta with humidex() < 0.001
+float humidexFast(float celsius, float DewPoint)
+{
+  float e = 19.833625f - 5417.753f /(273.16f + DewPoint);
+  return celsius + 3.3941f * _temperatureExp(e) - 5.555f;
+}
+
+
 // https://en.wikipedia.org/wiki/Heat_index
 // TODO add valid range for TF & R
 // TF = temp in Fahrenheit
@@ -131,6 +209,52 @@ float heatIndexC(float celcius, float humidity)
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// ARRAY VERSIONS - e.g. many rooms / sensors at once
+//
+// accuracy = TEMPERATURE_EXACT  dewPoint()
+//            TEMPERATURE_MAGNUS dewPointFast()
+//            TEMPERATURE_POLY   dewPointPoly()
+// the tier is selected once per array, not per element.
+void dewPoint_n(const float * celsius, const float * humidity, float * out, uint16_t n, uint8_t accuracy = TEMPERATURE_EXACT)
+{
+  if (accuracy == TEMPERATURE_POLY)
+  {
+    for (uint16_t i = 0; i < n; i++) out[i] = dewPointPoly(celsius[i], humidity[i]);
+  }
+  else if (accuracy == TEMPERATURE_MAGNUS)
+  {
+    for (uint16_t i = 0; i < n; i++) out[i] = dewPointFast(celsius[i], humidity[i]);
+  }
+  else
+  {
+    for (uint16_t i = 0; i < n; i++) out[i] = dewPoint(celsius[i], humidity[i]);
+  }
+}
+
+
+// TEMPERATURE_POLY uses humidexFast(), otherwise humidex().
+void humidex_n(const float * celsius, const float * dewpoint, float * out, uint16_t n, uint8_t accuracy = TEMPERATURE_EXACT)
+{
+  if (accuracy == TEMPERATURE_POLY)
+  {
+    for (uint16_t i = 0; i < n; i++) out[i] = humidexFast(celsius[i], dewpoint[i]);
+  }
+  else
+  {
+    for (uint16_t i = 0; i < n; i++) out[i] = humidex(celsius[i], dewpoint[i]);
+  }
+}
+
+
+// polynomial only, no tiers.
+void heatIndexC_n(const float * celsius, const float * humidity, float * out, uint16_t n)
+{
+  for (uint16_t i = 0; i < n; i++) out[i] = heatIndexC(celsius[i], humidity[i]);
+}
+
+
 // https://en.wikipedia.org/wiki/Wind_chill
 //    US     = Fahrenheit / miles
 //    METRIC = Celsius / meter/sec
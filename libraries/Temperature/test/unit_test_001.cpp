@@ -64,6 +64,44 @@ unittest(test_dewpoint)
 }
 
 
+unittest(test_dewpoint_poly)
+{
+  for (int cel = -20; cel <= 50; cel += 5)
+  {
+    for (int hum = 5; hum <= 100; hum += 5)
+    {
+      assertEqualFloat(dewPointFast(cel, hum), dewPointPoly(cel, hum), 0.001);
+      float dp = dewPoint(cel, hum);
+      assertEqualFloat(humidex(cel, dp), humidexFast(cel, dp), 0.001);
+    }
+  }
+}
+
+
+unittest(test_array)
+{
+  float T[4]  = { -10, 0, 20, 35 };
+  float RH[4] = { 30, 80, 50, 95 };
+  float out[4];
+  float dp[4];
+
+  dewPoint_n(T, RH, dp, 4);
+  for (int i = 0; i < 4; i++) assertEqualFloat(dewPoint(T[i], RH[i]), dp[i], 0.0001);
+  dewPoint_n(T, RH, out, 4, TEMPERATURE_MAGNUS);
+  for (int i = 0; i < 4; i++) assertEqualFloat(dewPointFast(T[i], RH[i]), out[i], 0.0001);
+  dewPoint_n(T, RH, out, 4, TEMPERATURE_POLY);
+  for (int i = 0; i < 4; i++) assertEqualFloat(dewPointPoly(T[i], RH[i]), out[i], 0.0001);
+
+  humidex_n(T, dp, out, 4);
+  for (int i = 0; i < 4; i++) assertEqualFloat(humidex(T[i], dp[i]), out[i], 0.0001);
+  humidex_n(T, dp, out, 4, TEMPERATURE_POLY);
+  for (int i = 0; i < 4; i++) assertEqualFloat(humidexFast(T[i], dp[i]), out[i], 0.0001);
+
+  heatIndexC_n(T, RH, out, 4);
+  for (int i = 0; i < 4; i++) assertEqualFloat(heatIndexC(T[i], RH[i]), out[i], 0.0001);
+}
+
+
 unittest(test_heatIndex)
 {
   assertEqualFloat(206.46,  heatIndex(20, 50), 0.001);
@@ -0,0 +1,429 @@
+//
+//    FILE: TimeSeriesCodec.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-16
+// PURPOSE: Arduino library to compress time series (Gorilla style) for EEPROM / FRAM logging
+//     URL: https://github.com/RobTillaart/TimeSeriesCodec
+//
+//  HISTORY:
+//  0.1.0   2021-09-16  initial version
+
+
+#include "TimeSeriesCodec.h"
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// HELPERS - portable, int is 16 bit on AVR
+//
+// x != 0
+static uint8_t _leadingZeros(uint32_t x)
+{
+  uint8_t n = 0;
+  if ((x & 0xFFFF0000UL) == 0) { n += 16; x <<= 16; }
+  if ((x & 0xFF000000UL) == 0) { n += 8;  x <<= 8;  }
+  if ((x & 0xF0000000UL) == 0) { n += 4;  x <<= 4;  }
+  if ((x & 0xC0000000UL) == 0) { n += 2;  x <<= 2;  }
+  if ((x & 0x80000000UL) == 0) { n += 1; }
+  return n;
+}
+
+
+// x != 0
+static uint8_t _trailingZeros(uint32_t x)
+{
+  uint8_t n = 0;
+  if ((x & 0x0000FFFFUL) == 0) { n += 16; x >>= 16; }
+  if ((x & 0x000000FFUL) == 0) { n += 8;  x >>= 8;  }
+  if ((x & 0x0000000FUL) == 0) { n += 4;  x >>= 4;  }
+  if ((x & 0x00000003UL) == 0) { n += 2;  x >>= 2;  }
+  if ((x & 0x00000001UL) == 0) { n += 1; }
+  return n;
+}
+
+
+static int32_t _signExtend(uint32_t value, uint8_t bits)
+{
+  uint32_t m = 1UL << (bits - 1);
+  return (int32_t)((value ^ m) - m);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIT WRITER
+//
+void TSBitWriter::begin(uint8_t * buffer, uint16_t size, uint32_t position)
+{
+  _buffer = buffer;
+  _bits   = size * 8UL;
+  _pos    = position;
+}
+
+
+// bits are assigned, not OR-ed, so after setPosition() back
+// the old bits are overwritten and the buffer needs no clearing.
+bool TSBitWriter::write(uint32_t value, uint8_t bits)
+{
+  if (_pos + bits > _bits) return false;
+  while (bits > 0)
+  {
+    uint8_t offset = _pos & 7;
+    uint8_t n = 8 - offset;
+    if (n > bits) n = bits;
+    uint8_t shift = 8 - offset - n;
+    uint8_t mask  = ((1 << n) - 1) << shift;
+    uint8_t chunk = (value >> (bits - n)) << shift;
+    uint8_t * p = &_buffer[_pos >> 3];
+    *p = (*p & ~mask) | (chunk & mask);
+    _pos += n;
+    bits -= n;
+  }
+  return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIT READER
+//
+void TSBitReader::begin(const uint8_t * buffer, uint16_t size, uint32_t position)
+{
+  _buffer = buffer;
+  _bits   = size * 8UL;
+  _pos    = position;
+  _error  = false;
+}
+
+
+uint32_t TSBitReader::read(uint8_t bits)
+{
+  if (_pos + bits > _bits)
+  {
+    _error = true;
+    return 0;
+  }
+  uint32_t value = 0;
+  while (bits > 0)
+  {
+    uint8_t offset = _pos & 7;
+    uint8_t n = 8 - offset;
+    if (n > bits) n = bits;
+    uint8_t chunk = _buffer[_pos >> 3] >> (8 - offset - n);
+    value = (value << n) | (chunk & ((1 << n) - 1));
+    _pos += n;
+    bits -= n;
+  }
+  return value;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// ENCODER
+//
+void TSEncoder::begin(uint8_t * buffer, uint16_t size, uint8_t type)
+{
+  _buffer = buffer;
+  _type   = type;
+  _count  = 0;
+  _prevTime  = 0;
+  _prevDelta = 0;
+  _prevValue = 0;
+  _prevValueDelta = 0;
+  _leading  = 0xFF;   // no window yet
+  _trailing = 0;
+  if (size < TS_HEADER_SIZE)
+  {
+    // every add() will fail
+    _writer.begin(buffer, 0, 0);
+    _type = 0;
+    return;
+  }
+  _buffer[0] = 0;
+  _buffer[1] = 0;
+  _buffer[2] = type;
+  _writer.begin(buffer, size, TS_HEADER_SIZE * 8);
+}
+
+
+bool TSEncoder::addFloat(uint32_t timestamp, float value)
+{
+  if (_type != TS_TYPE_FLOAT) return false;
+
+  uint32_t x;
+  memcpy(&x, &value, 4);
+  uint32_t pos = _writer.position();
+  int32_t  delta;
+  uint8_t  leading  = _leading;
+  uint8_t  trailing = _trailing;
+
+  bool ok = _writeTime(timestamp, delta);
+  if (ok)
+  {
+    uint32_t xr = x ^ _prevValue;
+    if (_count == 0)
+    {
+      ok = _writer.write(x, 32);
+    }
+    else if (xr == 0)
+    {
+      ok = _writer.write(0, 1);
+    }
+    else
+    {
+      uint8_t lz = _leadingZeros(xr);
+      uint8_t tz = _trailingZeros(xr);
+      if ((_leading != 0xFF) && (lz >= _leading) && (tz >= _trailing))
+      {
+        // fits in previous window
+        ok = _writer.write(0x02, 2) &&
+             _writer.write(xr >> _trailing, 32 - _leading - _trailing);
+      }
+      else
+      {
+        uint8_t len = 32 - lz - tz;
+        ok = _writer.write((0x03 << 10) | (lz << 5) | (len - 1), 12) &&
+             _writer.write(xr >> tz, len);
+        leading  = lz;
+        trailing = tz;
+      }
+    }
+  }
+  if (!ok)
+  {
+    _writer.setPosition(pos);
+    return false;
+  }
+  _leading  = leading;
+  _trailing = trailing;
+  _prevValue = x;
+  _commit(timestamp, delta);
+  return true;
+}
+
+
+bool TSEncoder::addInt32(uint32_t timestamp, int32_t value)
+{
+  if (_type != TS_TYPE_INT32) return false;
+
+  uint32_t pos = _writer.position();
+  int32_t  delta;
+  int32_t  valueDelta = 0;
+
+  bool ok = _writeTime(timestamp, delta);
+  if (ok)
+  {
+    if (_count == 0)
+    {
+      ok = _writer.write(value, 32);
+    }
+    else
+    {
+      // unsigned math => defined wrap around
+      valueDelta = (int32_t)((uint32_t)value - _prevValue);
+      ok = _writeDod((int32_t)((uint32_t)valueDelta - (uint32_t)_prevValueDelta));
+    }
+  }
+  if (!ok)
+  {
+    _writer.setPosition(pos);
+    return false;
+  }
+  _prevValue = value;
+  _prevValueDelta = valueDelta;
+  _commit(timestamp, delta);
+  return true;
+}
+
+
+float TSEncoder::ratio()
+{
+  if (_count == 0) return 0;
+  return (8.0 * _count) / bytes();
+}
+
+
+bool TSEncoder::_writeTime(uint32_t timestamp, int32_t & delta)
+{
+  if (_count == 0)
+  {
+    delta = 0;
+    return _writer.write(timestamp, 32);
+  }
+  delta = (int32_t)(timestamp - _prevTime);
+  return _writeDod((int32_t)((uint32_t)delta - (uint32_t)_prevDelta));
+}
+
+
+// prefix and value in one write where possible.
+bool TSEncoder::_writeDod(int32_t dod)
+{
+  if (dod == 0) return _writer.write(0, 1);
+  if ((dod >= -64) && (dod <= 63))
+  {
+    return _writer.write((0x02UL << 7) | (dod & 0x7F), 9);
+  }
+  if ((dod >= -256) && (dod <= 255))
+  {
+    return _writer.write((0x06UL << 9) | (dod & 0x1FF), 12);
+  }
+  if ((dod >= -2048) && (dod <= 2047))
+  {
+    return _writer.write((0x0EUL << 12) | (dod & 0xFFF), 16);
+  }
+  return _writer.write(0x0F, 4) && _writer.write(dod, 32);
+}
+
+
+void TSEncoder::_commit(uint32_t timestamp, int32_t delta)
+{
+  _prevTime  = timestamp;
+  _prevDelta = delta;
+  _count++;
+  _buffer[0] = _count & 0xFF;
+  _buffer[1] = _count >> 8;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DECODER
+//
+bool TSDecoder::begin(const uint8_t * buffer, uint16_t size)
+{
+  _count = 0;
+  _type  = 0;
+  _reader.begin(buffer, size, TS_HEADER_SIZE * 8);
+  if (size < TS_HEADER_SIZE) return false;
+  if ((buffer[2] != TS_TYPE_FLOAT) && (buffer[2] != TS_TYPE_INT32)) return false;
+  _count = buffer[0] | (buffer[1] << 8);
+  _type  = buffer[2];
+  _restart();
+  return true;
+}
+
+
+bool TSDecoder::readFloat(uint32_t & timestamp, float & value)
+{
+  if ((_type != TS_TYPE_FLOAT) || (_index >= _count)) return false;
+
+  uint32_t t;
+  _readTime(t);
+  uint32_t x = _prevValue;
+  if (_index == 0)
+  {
+    x = _reader.read(32);
+  }
+  else if (_reader.read(1) == 1)
+  {
+    if (_reader.read(1) == 1)
+    {
+      _leading  = _reader.read(5);
+      _trailing = 32 - _leading - (_reader.read(5) + 1);
+    }
+    x ^= _reader.read(32 - _leading - _trailing) << _trailing;
+  }
+  if (_reader.error()) return false;
+
+  _prevValue = x;
+  _index++;
+  timestamp = t;
+  memcpy(&value, &x, 4);
+  return true;
+}
+
+
+bool TSDecoder::readInt32(uint32_t & timestamp, int32_t & value)
+{
+  if ((_type != TS_TYPE_INT32) || (_index >= _count)) return false;
+
+  uint32_t t;
+  _readTime(t);
+  if (_index == 0)
+  {
+    _prevValue = _reader.read(32);
+  }
+  else
+  {
+    _prevValueDelta = (int32_t)((uint32_t)_prevValueDelta + _readDod());
+    _prevValue += _prevValueDelta;
+  }
+  if (_reader.error()) return false;
+
+  _index++;
+  timestamp = t;
+  value = (int32_t)_prevValue;
+  return true;
+}
+
+
+uint16_t TSDecoder::decodeFloat(uint32_t * timestamps, float * values, uint16_t maxCount)
+{
+  _restart();
+  uint16_t n = 0;
+  uint32_t t;
+  while ((n < maxCount) && readFloat(t, values[n]))
+  {
+    if (timestamps != NULL) timestamps[n] = t;
+    n++;
+  }
+  return n;
+}
+
+
+uint16_t TSDecoder::decodeInt32(uint32_t * timestamps, int32_t * values, uint16_t maxCount)
+{
+  _restart();
+  uint16_t n = 0;
+  uint32_t t;
+  while ((n < maxCount) && readInt32(t, values[n]))
+  {
+    if (timestamps != NULL) timestamps[n] = t;
+    n++;
+  }
+  return n;
+}
+
+
+void TSDecoder::_restart()
+{
+  _reader.setPosition(TS_HEADER_SIZE * 8);
+  _index     = 0;
+  _prevTime  = 0;
+  _prevDelta = 0;
+  _prevValue = 0;
+  _prevValueDelta = 0;
+  _leading   = 0;
+  _trailing  = 0;
+}
+
+
+void TSDecoder::_readTime(uint32_t & timestamp)
+{
+  if (_index == 0)
+  {
+    _prevTime  = _reader.read(32);
+    _prevDelta = 0;
+  }
+  else
+  {
+    _prevDelta = (int32_t)((uint32_t)_prevDelta + _readDod());
+    _prevTime += _prevDelta;
+  }
+  timestamp = _prevTime;
+}
+
+
+int32_t TSDecoder::_readDod()
+{
+  if (_reader.read(1) == 0) return 0;
+  if (_reader.read(1) == 0) return _signExtend(_reader.read(7), 7);
+  if (_reader.read(1) == 0) return _signExtend(_reader.read(9), 9);
+  if (_reader.read(1) == 0) return _signExtend(_reader.read(12), 12);
+  return (int32_t)_reader.read(32);
+}
+
+
+// -- END OF FILE --
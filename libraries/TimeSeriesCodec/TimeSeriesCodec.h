@@ -0,0 +1,145 @@
+#pragma once
+//
+//    FILE: TimeSeriesCodec.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+//    DATE: 2021-09-16
+// PURPOSE: Arduino library to compress time series (Gorilla style) for EEPROM / FRAM logging
+//     URL: https://github.com/RobTillaart/TimeSeriesCodec
+//
+
+
+#include "Arduino.h"
+
+
+#define TIMESERIESCODEC_LIB_VERSION       (F("0.1.0"))
+
+
+// block header: count (2 bytes LE) + type (1 byte)
+#define TS_HEADER_SIZE                    3
+
+#define TS_TYPE_FLOAT                     0x01
+#define TS_TYPE_INT32                     0x02
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// BIT WRITER / READER - MSB first
+//
+class TSBitWriter
+{
+public:
+  void     begin(uint8_t * buffer, uint16_t size, uint32_t position = 0);
+  // returns false if it does not fit, nothing is written then.
+  bool     write(uint32_t value, uint8_t bits);
+  uint32_t position()                  { return _pos; };
+  void     setPosition(uint32_t pos)   { _pos = pos; };
+  uint16_t bytes()                     { return (_pos + 7) / 8; };
+
+private:
+  uint8_t * _buffer;
+  uint32_t  _bits;
+  uint32_t  _pos;
+};
+
+
+class TSBitReader
+{
+public:
+  void     begin(const uint8_t * buffer, uint16_t size, uint32_t position = 0);
+  // returns 0 beyond the end, see error()
+  uint32_t read(uint8_t bits);
+  bool     error()                     { return _error; };
+  uint32_t position()                  { return _pos; };
+  void     setPosition(uint32_t pos)   { _pos = pos; _error = false; };
+
+private:
+  const uint8_t * _buffer;
+  uint32_t  _bits;
+  uint32_t  _pos;
+  bool      _error;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// ENCODER - one block, e.g. an EEPROM page or a FRAM record
+//
+// timestamps : delta of delta,  0 | 10 + 7 | 110 + 9 | 1110 + 12 | 1111 + 32 bits
+// float      : XOR with previous, 0 | 10 + previous window | 11 + 5 leading + 5 (length - 1) + window
+// int32      : delta of delta as timestamps
+//
+class TSEncoder
+{
+public:
+  // size includes the TS_HEADER_SIZE bytes header.
+  void     begin(uint8_t * buffer, uint16_t size, uint8_t type = TS_TYPE_FLOAT);
+
+  // return false if the block is full (or wrong type), the sample is not added.
+  bool     addFloat(uint32_t timestamp, float value);
+  bool     addInt32(uint32_t timestamp, int32_t value);
+
+  uint16_t count()   { return _count; };
+  // bytes used including header, write these to storage.
+  uint16_t bytes()   { return _writer.bytes(); };
+  // raw size (8 bytes per sample) / bytes()
+  float    ratio();
+
+private:
+  bool     _writeTime(uint32_t timestamp, int32_t & delta);
+  bool     _writeDod(int32_t dod);
+  void     _commit(uint32_t timestamp, int32_t delta);
+
+  TSBitWriter _writer;
+  uint8_t *   _buffer;
+  uint8_t     _type;
+  uint16_t    _count;
+  uint32_t    _prevTime;
+  int32_t     _prevDelta;
+  uint32_t    _prevValue;     // float bits or int32
+  int32_t     _prevValueDelta;
+  uint8_t     _leading;
+  uint8_t     _trailing;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// DECODER
+//
+class TSDecoder
+{
+public:
+  // returns false if the header is not valid.
+  bool     begin(const uint8_t * buffer, uint16_t size);
+  uint16_t count()   { return _count; };
+  uint8_t  type()    { return _type; };
+
+  // sequential, return false after the last sample or on error.
+  bool     readFloat(uint32_t & timestamp, float & value);
+  bool     readInt32(uint32_t & timestamp, int32_t & value);
+
+  // whole block from the start, returns the number of samples decoded.
+  // timestamps may be NULL.
+  uint16_t decodeFloat(uint32_t * timestamps, float * values, uint16_t maxCount);
+  uint16_t decodeInt32(uint32_t * timestamps, int32_t * values, uint16_t maxCount);
+
+private:
+  void     _restart();
+  void     _readTime(uint32_t & timestamp);
+  int32_t  _readDod();
+
+  TSBitReader _reader;
+  uint8_t     _type;
+  uint16_t    _count;
+  uint16_t    _index;
+  uint32_t    _prevTime;
+  int32_t     _prevDelta;
+  uint32_t    _prevValue;
+  int32_t     _prevValueDelta;
+  uint8_t     _leading;
+  uint8_t     _trailing;
+};
+
+
+// -- END OF FILE --
@@ -0,0 +1,106 @@
+//
+//    FILE: TimeSeriesCodec_eeprom_logger.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: log a temperature in compressed pages to an external EEPROM
+//    DATE: 2021-09-16
+//     URL: https://github.com/RobTillaart/TimeSeriesCodec
+//
+// needs https://github.com/RobTillaart/I2C_EEPROM
+//
+// one block per 64 byte EEPROM page, the block is written when full,
+// so every page is written once per cycle through the EEPROM.
+
+
+#include "TimeSeriesCodec.h"
+#include "I2C_eeprom.h"
+
+
+#define PAGESIZE        64
+#define EEPROM_SIZE     I2C_DEVICESIZE_24LC256
+
+I2C_eeprom ee(0x50, EEPROM_SIZE);
+
+uint8_t   page[PAGESIZE];
+uint16_t  address = 0;
+TSEncoder encoder;
+
+uint32_t  lastSample = 0;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("TIMESERIESCODEC_LIB_VERSION: ");
+  Serial.println(TIMESERIESCODEC_LIB_VERSION);
+
+  ee.begin();
+  encoder.begin(page, PAGESIZE, TS_TYPE_INT32);
+}
+
+
+void loop()
+{
+  if (millis() - lastSample >= 1000)
+  {
+    lastSample = millis();
+    // 0.1 C as int32 compresses much better than a float.
+    int32_t value = round(readTemperature() * 10);
+    if (encoder.addInt32(lastSample, value) == false)
+    {
+      flush();
+      encoder.addInt32(lastSample, value);
+    }
+  }
+
+  if (Serial.available() && (Serial.read() == 'd'))
+  {
+    dump();
+  }
+}
+
+
+void flush()
+{
+  ee.writeBlock(address, page, PAGESIZE);
+  Serial.print("page ");
+  Serial.print(address / PAGESIZE);
+  Serial.print("\t");
+  Serial.print(encoder.count());
+  Serial.print(" samples\tratio ");
+  Serial.println(encoder.ratio(), 2);
+  address += PAGESIZE;
+  if (address >= EEPROM_SIZE) address = 0;
+  encoder.begin(page, PAGESIZE, TS_TYPE_INT32);
+}
+
+
+void dump()
+{
+  uint8_t   buf[PAGESIZE];
+  TSDecoder decoder;
+  for (uint16_t a = 0; a < address; a += PAGESIZE)
+  {
+    ee.readBlock(a, buf, PAGESIZE);
+    if (decoder.begin(buf, PAGESIZE) == false) continue;
+    uint32_t t;
+    int32_t  v;
+    while (decoder.readInt32(t, v))
+    {
+      Serial.print(t);
+      Serial.print("\t");
+      Serial.println(v * 0.1, 1);
+    }
+  }
+}
+
+
+float readTemperature()
+{
+  // replace with a real sensor
+  return 20.0 + analogRead(A0) * 0.01;
+}
+
+
+// -- END OF FILE --
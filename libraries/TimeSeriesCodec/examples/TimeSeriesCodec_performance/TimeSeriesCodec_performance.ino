@@ -0,0 +1,119 @@
+//
+//    FILE: TimeSeriesCodec_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: compression ratio and encode / decode speed
+//    DATE: 2021-09-16
+//     URL: https://github.com/RobTillaart/TimeSeriesCodec
+//
+// the traces are synthetic, replace them with a recorded log to
+// see what your sensor does.
+
+
+#include "TimeSeriesCodec.h"
+
+
+#define BLOCKSIZE   256
+#define SAMPLES     200
+
+uint8_t  block[BLOCKSIZE];
+uint32_t ts[SAMPLES];
+float    fv[SAMPLES];
+int32_t  iv[SAMPLES];
+
+TSEncoder encoder;
+TSDecoder decoder;
+
+uint32_t start, stop;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("TIMESERIESCODEC_LIB_VERSION: ");
+  Serial.println(TIMESERIESCODEC_LIB_VERSION);
+  Serial.println();
+
+  // temperature 0.1 C resolution, every 10 seconds
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    ts[i] = 1631800000UL + i * 10;
+    fv[i] = round(200 + 30 * sin(i * 0.005) + random(3) - 1) * 0.1;
+  }
+  test_float("temperature float");
+
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    iv[i] = round(fv[i] * 10);
+  }
+  test_int32("temperature x10 int32");
+
+  // power in W, a load switching, millis() with jitter
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    ts[i] = i * 1000UL + random(3);
+    iv[i] = 120 + (((i / 50) % 3 == 1) ? 2000 : 0) + random(2);
+  }
+  test_int32("power int32");
+
+  Serial.println("\ndone...");
+}
+
+
+void loop()
+{
+}
+
+
+void test_float(const char * name)
+{
+  uint16_t n = 0;
+  start = micros();
+  encoder.begin(block, BLOCKSIZE, TS_TYPE_FLOAT);
+  while ((n < SAMPLES) && encoder.addFloat(ts[n], fv[n])) n++;
+  stop = micros();
+  report(name, n, stop - start);
+
+  start = micros();
+  decoder.begin(block, encoder.bytes());
+  uint16_t m = decoder.decodeFloat(ts, fv, SAMPLES);
+  stop = micros();
+  Serial.print("  decode us/sample:\t");
+  Serial.println((stop - start) * 1.0 / m, 2);
+}
+
+
+void test_int32(const char * name)
+{
+  uint16_t n = 0;
+  start = micros();
+  encoder.begin(block, BLOCKSIZE, TS_TYPE_INT32);
+  while ((n < SAMPLES) && encoder.addInt32(ts[n], iv[n])) n++;
+  stop = micros();
+  report(name, n, stop - start);
+
+  start = micros();
+  decoder.begin(block, encoder.bytes());
+  uint16_t m = decoder.decodeInt32(ts, iv, SAMPLES);
+  stop = micros();
+  Serial.print("  decode us/sample:\t");
+  Serial.println((stop - start) * 1.0 / m, 2);
+}
+
+
+void report(const char * name, uint16_t n, uint32_t duration)
+{
+  Serial.println(name);
+  Serial.print("  samples:\t\t");
+  Serial.println(n);
+  Serial.print("  bytes:\t\t");
+  Serial.println(encoder.bytes());
+  Serial.print("  ratio:\t\t");
+  Serial.println(encoder.ratio(), 2);
+  Serial.print("  encode us/sample:\t");
+  Serial.println(duration * 1.0 / n, 2);
+}
+
+
+// -- END OF FILE --
@@ -0,0 +1,245 @@
+//
+//    FILE: unit_test_001.cpp
+//  AUTHOR: Rob Tillaart
+//    DATE: 2021-09-16
+// PURPOSE: unit tests for the TimeSeriesCodec library
+//          https://github.com/RobTillaart/TimeSeriesCodec
+//          https://github.com/Arduino-CI/arduino_ci/blob/master/REFERENCE.md
+//
+
+// supported assertions
+// ----------------------------
+// assertEqual(expected, actual);               // a == b
+// assertNotEqual(unwanted, actual);            // a != b
+// assertComparativeEquivalent(expected, actual);    // abs(a - b) == 0 or (!(a > b) && !(a < b))
+// assertComparativeNotEquivalent(unwanted, actual); // abs(a - b) > 0  or ((a > b) || (a < b))
+// assertLess(upperBound, actual);              // a < b
+// assertMore(lowerBound, actual);              // a > b
+// assertLessOrEqual(upperBound, actual);       // a <= b
+// assertMoreOrEqual(lowerBound, actual);       // a >= b
+// assertTrue(actual);
+// assertFalse(actual);
+// assertNull(actual);
+
+// // special cases for floats
+// assertEqualFloat(expected, actual, epsilon);    // fabs(a - b) <= epsilon
+// assertNotEqualFloat(unwanted, actual, epsilon); // fabs(a - b) >= epsilon
+// assertInfinity(actual);                         // isinf(a)
+// assertNotInfinity(actual);                      // !isinf(a)
+// assertNAN(arg);                                 // isnan(a)
+// assertNotNAN(arg);                              // !isnan(a)
+
+
+
+#include <ArduinoUnitTests.h>
+
+#include "Arduino.h"
+#include "TimeSeriesCodec.h"
+
+
+// synthetic temperature trace, 0.1 C resolution, slow drift, sample every 10 s.
+float temperature(uint16_t i)
+{
+  return round(200 + 30 * sin(i * 0.005) + ((i * 7) % 3 - 1)) * 0.1;
+}
+
+
+// synthetic power trace in W, a load that switches on and off.
+int32_t power(uint16_t i)
+{
+  int32_t p = 120;
+  if ((i / 50) % 3 == 1) p += 2000;
+  if ((i % 17) == 0) p += 3;
+  return p;
+}
+
+
+unittest_setup()
+{
+  fprintf(stderr, "TIMESERIESCODEC_LIB_VERSION: %s\n", (char *) TIMESERIESCODEC_LIB_VERSION);
+}
+
+
+unittest_teardown()
+{
+}
+
+
+unittest(test_bit_writer_reader)
+{
+  uint8_t buf[16];
+  TSBitWriter bw;
+  bw.begin(buf, 16);
+  assertTrue(bw.write(1, 1));
+  assertTrue(bw.write(0x5A, 7));
+  assertTrue(bw.write(0xDEADBEEF, 32));
+  assertTrue(bw.write(0x3, 3));
+  assertEqual(43, bw.position());
+  assertEqual(6, bw.bytes());
+
+  // rollback overwrites, no need to clear
+  bw.setPosition(40);
+  assertTrue(bw.write(0x0, 3));
+  assertFalse(bw.write(0, 32 * 3));   // does not fit
+  assertEqual(43, bw.position());
+
+  TSBitReader br;
+  br.begin(buf, 6);
+  assertEqual(1, br.read(1));
+  assertEqual(0x5A, br.read(7));
+  assertEqual(0xDEADBEEF, br.read(32));
+  assertEqual(0, br.read(3));
+  assertFalse(br.error());
+  assertEqual(0, br.read(8));
+  assertTrue(br.error());
+}
+
+
+unittest(test_float_round_trip)
+{
+  uint8_t buf[256];
+  TSEncoder enc;
+  enc.begin(buf, sizeof(buf), TS_TYPE_FLOAT);
+  assertFalse(enc.addInt32(0, 1));    // wrong type
+
+  float v[] = { 20.1, 20.1, 20.2, -5.5, 1e30, 0, -0.0, 3.14159, 3.14159, 20.1 };
+  uint32_t t[] = { 1000, 1010, 1020, 1030, 1031, 5000, 5010, 4000, 0xFFFFFFFF, 2 };
+  for (int i = 0; i < 10; i++) assertTrue(enc.addFloat(t[i], v[i]));
+  assertEqual(10, enc.count());
+
+  TSDecoder dec;
+  assertTrue(dec.begin(buf, enc.bytes()));
+  assertEqual(10, dec.count());
+  assertEqual(TS_TYPE_FLOAT, dec.type());
+  uint32_t ts;
+  float f;
+  for (int i = 0; i < 10; i++)
+  {
+    assertTrue(dec.readFloat(ts, f));
+    assertEqual(t[i], ts);
+    assertEqual(0, memcmp(&f, &v[i], 4));    // bit exact
+  }
+  assertFalse(dec.readFloat(ts, f));
+}
+
+
+unittest(test_int32_round_trip)
+{
+  uint8_t buf[256];
+  TSEncoder enc;
+  enc.begin(buf, sizeof(buf), TS_TYPE_INT32);
+  assertFalse(enc.addFloat(0, 1));    // wrong type
+
+  int32_t v[] = { 0, 1, 2, 3, 100, -100, 2147483647L, -2147483647L - 1, 0, 0 };
+  for (int i = 0; i < 10; i++) assertTrue(enc.addInt32(i * 60, v[i]));
+
+  TSDecoder dec;
+  assertTrue(dec.begin(buf, sizeof(buf)));
+  uint32_t ts[12];
+  int32_t  val[12];
+  assertEqual(10, dec.decodeInt32(ts, val, 12));
+  for (int i = 0; i < 10; i++)
+  {
+    assertEqual((uint32_t)i * 60, ts[i]);
+    assertEqual(v[i], val[i]);
+  }
+  // decode restarts, maxCount respected
+  assertEqual(4, dec.decodeInt32(NULL, val, 4));
+  assertEqual(v[3], val[3]);
+}
+
+
+unittest(test_block_full)
+{
+  uint8_t buf[32];
+  TSEncoder enc;
+  enc.begin(buf, sizeof(buf), TS_TYPE_FLOAT);
+  uint16_t n = 0;
+  while (enc.addFloat(n * 10, n * 1.37)) n++;
+  assertMore(n, 3);
+  assertEqual(n, enc.count());
+  assertLessOrEqual(enc.bytes(), 32);
+
+  // a failed add does not damage the block
+  TSDecoder dec;
+  assertTrue(dec.begin(buf, sizeof(buf)));
+  float v[64];
+  assertEqual(n, dec.decodeFloat(NULL, v, 64));
+  for (uint16_t i = 0; i < n; i++) assertEqual(i * 1.37f, v[i]);
+
+  // too small for the header
+  enc.begin(buf, 2);
+  assertFalse(enc.addFloat(0, 0));
+  assertFalse(dec.begin(buf, 2));
+}
+
+
+unittest(test_ratio_temperature)
+{
+  uint8_t buf[1024];
+  TSEncoder enc;
+  enc.begin(buf, sizeof(buf), TS_TYPE_FLOAT);
+  uint32_t t = 1631800000UL;
+  uint16_t n = 0;
+  while (enc.addFloat(t, temperature(n)))
+  {
+    t += 10;
+    n++;
+  }
+  fprintf(stderr, "temperature: %d samples, %d bytes, ratio %1.2f\n", n, enc.bytes(), enc.ratio());
+  assertMore(enc.ratio(), 2.0);
+
+  TSDecoder dec;
+  assertTrue(dec.begin(buf, enc.bytes()));
+  uint32_t ts;
+  float f;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    assertTrue(dec.readFloat(ts, f));
+    assertEqual(temperature(i), f);
+  }
+
+  // same trace as int32 in 0.1 C
+  enc.begin(buf, sizeof(buf), TS_TYPE_INT32);
+  t = 1631800000UL;
+  n = 0;
+  while (enc.addInt32(t, round(temperature(n) * 10)))
+  {
+    t += 10;
+    n++;
+  }
+  fprintf(stderr, "temperature x10: %d samples, %d bytes, ratio %1.2f\n", n, enc.bytes(), enc.ratio());
+  assertMore(enc.ratio(), 5.0);
+}
+
+
+unittest(test_ratio_power)
+{
+  uint8_t buf[1024];
+  TSEncoder enc;
+  enc.begin(buf, sizeof(buf), TS_TYPE_INT32);
+  uint32_t t = 0;
+  uint16_t n = 0;
+  while (enc.addInt32(t, power(n)))
+  {
+    t += 1000 + (n % 3);    // millis() with jitter
+    n++;
+  }
+  fprintf(stderr, "power: %d samples, %d bytes, ratio %1.2f\n", n, enc.bytes(), enc.ratio());
+  assertMore(enc.ratio(), 4.0);
+
+  TSDecoder dec;
+  assertTrue(dec.begin(buf, enc.bytes()));
+  uint32_t ts;
+  int32_t  v;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    assertTrue(dec.readInt32(ts, v));
+    assertEqual(power(i), v);
+  }
+}
+
+
+unittest_main()
+
+// --------
@@ -1,7 +1,7 @@
 //
 //    FILE: Troolean.cpp
 //  AUTHOR: Rob Tillaart
-// VERSION: 0.1.4
+// VERSION: 0.1.5
 // PURPOSE: Arduino Library for a three state logic datatype supporting {true false unknown}
 //     URL: https://github.com/RobTillaart/Troolean
 //
@@ -14,6 +14,8 @@
 //  0.1.2  2020-06-07  small refactor; updated keywords.txt; metadata
 //  0.1.3  2020-06-19  fix library.json
 //  0.1.4  2021-01-09  arduino-CI + unit test
+//  0.1.5  2021-09-07  add TrooleanArray, packed 2 bit values
+//                     fix operator || (bool)
 
 #include "Troolean.h"
 
@@ -135,8 +137,8 @@ Troolean Troolean::operator || (const Troolean &t)
 
 Troolean Troolean::operator || (const bool &b)
 {
-  if (_value == 1 || b) return Troolean(0);
-  if (_value == 0 && !b) return Troolean(1);
+  if (_value == 1 || b) return Troolean(1);
+  if (_value == 0 && !b) return Troolean(0);
   return Troolean(-1);
 }
 
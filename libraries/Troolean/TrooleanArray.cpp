@@ -0,0 +1,205 @@
+//
+//    FILE: TrooleanArray.cpp
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.5
+// PURPOSE: Arduino Library for a packed array of three state logic values
+//     URL: https://github.com/RobTillaart/Troolean
+//
+//  HISTORY: see Troolean.cpp
+
+
+#include "TrooleanArray.h"
+
+
+/////////////////////////////////////////////////////
+//
+// PUBLIC
+//
+TrooleanArray::TrooleanArray(const uint16_t size)
+{
+  _size  = size;
+  _words = (_size + 31) / 32;
+  _known = (uint32_t *) malloc(_words * sizeof(uint32_t));
+  _value = (uint32_t *) malloc(_words * sizeof(uint32_t));
+  if ((_known == NULL) || (_value == NULL))
+  {
+    free(_known);
+    free(_value);
+    _known = NULL;
+    _value = NULL;
+    _size  = 0;
+    _words = 0;
+  }
+  setAll(Troolean(unknown));
+}
+
+
+TrooleanArray::~TrooleanArray()
+{
+  free(_known);
+  free(_value);
+}
+
+
+void TrooleanArray::set(const uint16_t index, const Troolean & t)
+{
+  if (index >= _size) return;
+  uint16_t w = index / 32;
+  uint32_t mask = 1UL << (index & 31);
+  Troolean tt(t);
+  if (tt.isUnknown())
+  {
+    _known[w] &= ~mask;
+    _value[w] &= ~mask;
+    return;
+  }
+  _known[w] |= mask;
+  if (tt.isTrue()) _value[w] |= mask;
+  else             _value[w] &= ~mask;
+}
+
+
+Troolean TrooleanArray::get(const uint16_t index)
+{
+  if (index >= _size) return Troolean(unknown);
+  uint16_t w = index / 32;
+  uint32_t mask = 1UL << (index & 31);
+  if ((_known[w] & mask) == 0) return Troolean(unknown);
+  if (_value[w] & mask) return Troolean(1);
+  return Troolean(0);
+}
+
+
+void TrooleanArray::setAll(const Troolean & t)
+{
+  Troolean tt(t);
+  uint32_t k = tt.isUnknown() ? 0 : 0xFFFFFFFF;
+  uint32_t v = tt.isTrue()    ? 0xFFFFFFFF : 0;
+  for (uint16_t w = 0; w < _words; w++)
+  {
+    _known[w] = k;
+    _value[w] = v;
+  }
+}
+
+
+bool TrooleanArray::copy(const TrooleanArray & arr)
+{
+  if (arr._size != _size) return false;
+  for (uint16_t w = 0; w < _words; w++)
+  {
+    _known[w] = arr._known[w];
+    _value[w] = arr._value[w];
+  }
+  return true;
+}
+
+
+// AND
+// false if one is false, true if both are true, otherwise unknown
+bool TrooleanArray::andWith(const TrooleanArray & arr)
+{
+  if (arr._size != _size) return false;
+  for (uint16_t w = 0; w < _words; w++)
+  {
+    uint32_t f1 = _known[w] & ~_value[w];
+    uint32_t f2 = arr._known[w] & ~arr._value[w];
+    _value[w] &= arr._value[w];
+    _known[w] = _value[w] | f1 | f2;
+  }
+  return true;
+}
+
+
+// OR
+// true if one is true, false if both are false, otherwise unknown
+bool TrooleanArray::orWith(const TrooleanArray & arr)
+{
+  if (arr._size != _size) return false;
+  for (uint16_t w = 0; w < _words; w++)
+  {
+    uint32_t f1 = _known[w] & ~_value[w];
+    uint32_t f2 = arr._known[w] & ~arr._value[w];
+    _value[w] |= arr._value[w];
+    _known[w] = _value[w] | (f1 & f2);
+  }
+  return true;
+}
+
+
+// NEGATE
+// t -> f
+// f -> t
+// u -> u
+void TrooleanArray::negate()
+{
+  for (uint16_t w = 0; w < _words; w++)
+  {
+    _value[w] = _known[w] & ~_value[w];
+  }
+}
+
+
+uint16_t TrooleanArray::countTrue()
+{
+  if (_words == 0) return 0;
+  uint16_t count = 0;
+  for (uint16_t w = 0; w < _words - 1; w++)
+  {
+    count += _popcount(_value[w]);
+  }
+  count += _popcount(_value[_words - 1] & _lastMask());
+  return count;
+}
+
+
+uint16_t TrooleanArray::countFalse()
+{
+  if (_words == 0) return 0;
+  uint16_t count = 0;
+  for (uint16_t w = 0; w < _words - 1; w++)
+  {
+    count += _popcount(_known[w] & ~_value[w]);
+  }
+  uint16_t w = _words - 1;
+  count += _popcount(_known[w] & ~_value[w] & _lastMask());
+  return count;
+}
+
+
+uint16_t TrooleanArray::countUnknown()
+{
+  if (_words == 0) return 0;
+  uint16_t known = 0;
+  for (uint16_t w = 0; w < _words - 1; w++)
+  {
+    known += _popcount(_known[w]);
+  }
+  known += _popcount(_known[_words - 1] & _lastMask());
+  return _size - known;
+}
+
+
+/////////////////////////////////////////////////////
+//
+// PRIVATE
+//
+
+// valid bits of the last word
+uint32_t TrooleanArray::_lastMask()
+{
+  uint8_t bits = _size & 31;
+  if (bits == 0) return 0xFFFFFFFF;
+  return (1UL << bits) - 1;
+}
+
+
+uint8_t TrooleanArray::_popcount(uint32_t x)
+{
+  x = x - ((x >> 1) & 0x55555555);
+  x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+  x = (x + (x >> 4)) & 0x0F0F0F0F;
+  return (x * 0x01010101) >> 24;
+}
+
+// -- END OF FILE --
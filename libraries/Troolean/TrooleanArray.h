@@ -0,0 +1,55 @@
+#pragma once
+//
+//    FILE: TrooleanArray.h
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.5
+// PURPOSE: Arduino Library for a packed array of three state logic values
+//     URL: https://github.com/RobTillaart/Troolean
+//
+//  Every value uses 2 bits in two bitplanes.
+//
+//  value     known  value
+//  true        1      1
+//  false       1      0
+//  unknown     0      0
+//
+//  Logic operators work on 32 values in parallel.
+
+
+#include "Troolean.h"
+
+
+class TrooleanArray
+{
+public:
+  explicit TrooleanArray(const uint16_t size);
+  ~TrooleanArray();
+
+  uint16_t size()   { return _size; };
+
+  void     set(const uint16_t index, const Troolean & t);
+  Troolean get(const uint16_t index);
+  void     setAll(const Troolean & t);
+
+  // in place, returns false if size differs
+  bool     copy(const TrooleanArray & arr);
+  bool     andWith(const TrooleanArray & arr);
+  bool     orWith(const TrooleanArray & arr);
+  void     negate();
+
+  uint16_t countTrue();
+  uint16_t countFalse();
+  uint16_t countUnknown();
+
+
+private:
+  uint16_t _size;
+  uint16_t _words;
+  uint32_t * _known;
+  uint32_t * _value;
+
+  uint32_t _lastMask();
+  uint8_t  _popcount(uint32_t x);
+};
+
+// -- END OF FILE --
@@ -0,0 +1,105 @@
+//
+//    FILE: TrooleanArray_performance.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: compare Troolean array with packed TrooleanArray
+//     URL: https://github.com/RobTillaart/Troolean
+
+
+#include "Troolean.h"
+#include "TrooleanArray.h"
+
+
+#define SIZE    500
+
+Troolean a[SIZE];
+Troolean b[SIZE];
+
+TrooleanArray A(SIZE);
+TrooleanArray B(SIZE);
+
+uint32_t start, stop;
+volatile uint16_t count;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("TROOLEAN_LIB_VERSION: ");
+  Serial.println(TROOLEAN_LIB_VERSION);
+  Serial.println();
+
+  for (int i = 0; i < SIZE; i++)
+  {
+    int r = random(3) - 1;
+    a[i] = Troolean(r);
+    A.set(i, a[i]);
+    r = random(3) - 1;
+    b[i] = Troolean(r);
+    B.set(i, b[i]);
+  }
+
+  Serial.print("RAM Troolean[]:\t");
+  Serial.println(sizeof(a));
+  Serial.print("RAM TrooleanArray:\t");
+  Serial.println(((SIZE + 31) / 32) * 8);
+  Serial.println();
+
+  start = micros();
+  for (int i = 0; i < SIZE; i++) a[i] = a[i] && b[i];
+  stop = micros();
+  Serial.print("Troolean[]   AND:\t");
+  Serial.println(stop - start);
+
+  start = micros();
+  A.andWith(B);
+  stop = micros();
+  Serial.print("TrooleanArray AND:\t");
+  Serial.println(stop - start);
+  delay(10);
+
+  start = micros();
+  for (int i = 0; i < SIZE; i++) a[i] = a[i] || b[i];
+  stop = micros();
+  Serial.print("Troolean[]   OR:\t");
+  Serial.println(stop - start);
+
+  start = micros();
+  A.orWith(B);
+  stop = micros();
+  Serial.print("TrooleanArray OR:\t");
+  Serial.println(stop - start);
+  delay(10);
+
+  start = micros();
+  count = 0;
+  for (int i = 0; i < SIZE; i++) if (a[i].isUnknown()) count++;
+  stop = micros();
+  Serial.print("Troolean[]   count:\t");
+  Serial.println(stop - start);
+
+  start = micros();
+  count = A.countUnknown();
+  stop = micros();
+  Serial.print("TrooleanArray count:\t");
+  Serial.println(stop - start);
+  Serial.println();
+
+  // verify
+  int errors = 0;
+  for (int i = 0; i < SIZE; i++)
+  {
+    if (a[i] != A.get(i)) errors++;
+  }
+  Serial.print("errors:\t");
+  Serial.println(errors);
+}
+
+
+void loop()
+{
+}
+
+
+// -- END OF FILE --
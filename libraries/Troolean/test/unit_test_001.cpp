@@ -34,6 +34,7 @@
 
 #include "Arduino.h"
 #include "Troolean.h"
+#include "TrooleanArray.h"
 
 
 unittest_setup()
@@ -69,6 +70,85 @@ unittest(test_constructor)
 
 // TODO extend operators  comparison etc
 
+unittest(test_operators_bool)
+{
+  Troolean f(false);
+  Troolean t(true);
+  Troolean u(-1);
+
+  assertTrue((t || false).isTrue());
+  assertTrue((f || true).isTrue());
+  assertTrue((f || false).isFalse());
+  assertTrue((u || false).isUnknown());
+  assertTrue((t && true).isTrue());
+  assertTrue((u && false).isFalse());
+}
+
+
+unittest(test_array_set_get)
+{
+  TrooleanArray arr(70);
+  assertEqual(70, arr.size());
+  assertEqual(70, arr.countUnknown());
+
+  arr.set(0, true);
+  arr.set(33, false);
+  arr.set(69, true);
+  arr.set(70, true);   // out of range
+  assertTrue(arr.get(0).isTrue());
+  assertTrue(arr.get(33).isFalse());
+  assertTrue(arr.get(69).isTrue());
+  assertTrue(arr.get(1).isUnknown());
+  assertEqual(2, arr.countTrue());
+  assertEqual(1, arr.countFalse());
+  assertEqual(67, arr.countUnknown());
+
+  arr.setAll(false);
+  assertEqual(0, arr.countTrue());
+  assertEqual(70, arr.countFalse());
+  assertEqual(0, arr.countUnknown());
+  arr.set(69, unknown);
+  assertEqual(1, arr.countUnknown());
+}
+
+
+unittest(test_array_logic)
+{
+  // all 9 combinations, crossing word boundaries
+  const int N = 99;
+  Troolean vals[3] = { Troolean(0), Troolean(1), Troolean(-1) };
+  TrooleanArray A(N), B(N), C(N), D(N);
+  for (int i = 0; i < N; i++)
+  {
+    A.set(i, vals[i % 3]);
+    B.set(i, vals[(i / 3) % 3]);
+  }
+  assertTrue(C.copy(A));
+  assertTrue(C.andWith(B));
+  assertTrue(D.copy(A));
+  assertTrue(D.orWith(B));
+  for (int i = 0; i < N; i++)
+  {
+    assertTrue((vals[i % 3] && vals[(i / 3) % 3]) == C.get(i));
+    assertTrue((vals[i % 3] || vals[(i / 3) % 3]) == D.get(i));
+  }
+  C.copy(A);
+  C.negate();
+  for (int i = 0; i < N; i++)
+  {
+    assertTrue((!vals[i % 3]) == C.get(i));
+  }
+  assertEqual(33, C.countTrue());
+  assertEqual(33, C.countFalse());
+  assertEqual(33, C.countUnknown());
+
+  TrooleanArray E(10);
+  assertFalse(E.andWith(A));
+  assertFalse(E.orWith(A));
+  assertFalse(E.copy(A));
+}
+
+
 unittest_main()
 
 // --------
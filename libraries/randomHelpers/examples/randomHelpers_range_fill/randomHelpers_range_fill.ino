@@ -0,0 +1,121 @@
+//
+//    FILE: randomHelpers_range_fill.ino
+//  AUTHOR: Rob Tillaart
+// VERSION: 0.1.0
+// PURPOSE: performance randomRange() and fill()
+//    DATE: 2021-09-22
+//     URL: https://github.com/RobTillaart/randomHelpers
+
+#include "randomHelpers.h"
+
+RandomHelper rh(12345, 67890);
+
+uint8_t buf[256];
+uint32_t start, duration1, duration2, duration3;
+
+volatile uint32_t x;
+
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println(__FILE__);
+  Serial.print("RANDOM_HELPERS_VERSION: ");
+  Serial.println(RANDOM_HELPERS_VERSION);
+  Serial.println();
+
+  Serial.println("n\trandom(n)\t% n\trandomRange(n)");
+  test_range(6);
+  test_range(1000);
+  test_range(100000);
+  Serial.println("(us per call)\n");
+
+  test_fill();
+  test_dice();
+}
+
+
+void loop()
+{
+}
+
+
+void test_range(uint32_t n)
+{
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1000; i++) x = random(n);
+  duration1 = micros() - start;
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1000; i++) x = rh.getRandom32() % n;
+  duration2 = micros() - start;
+
+  delay(10);
+  start = micros();
+  for (int i = 0; i < 1000; i++) x = rh.randomRange(n);
+  duration3 = micros() - start;
+
+  Serial.print(n);
+  Serial.print("\t");
+  Serial.print(duration1 * 0.001, 3);
+  Serial.print("\t\t");
+  Serial.print(duration2 * 0.001, 3);
+  Serial.print("\t");
+  Serial.println(duration3 * 0.001, 3);
+}
+
+
+void test_fill()
+{
+  delay(10);
+  start = micros();
+  for (int r = 0; r < 10; r++)
+  {
+    for (int i = 0; i < 256; i++) buf[i] = random(256);
+  }
+  duration1 = micros() - start;
+
+  delay(10);
+  start = micros();
+  for (int r = 0; r < 10; r++)
+  {
+    for (int i = 0; i < 256; i++) buf[i] = rh.getRandom8();
+  }
+  duration2 = micros() - start;
+
+  delay(10);
+  start = micros();
+  for (int r = 0; r < 10; r++) rh.fill(buf, 256);
+  duration3 = micros() - start;
+
+  Serial.println("bytes\trandom(256)\tgetRandom8()\tfill()");
+  Serial.print(2560);
+  Serial.print("\t");
+  Serial.print(duration1);
+  Serial.print("\t\t");
+  Serial.print(duration2);
+  Serial.print("\t\t");
+  Serial.println(duration3);
+  Serial.println("(us total)\n");
+}
+
+
+void test_dice()
+{
+  uint32_t count[7] = { 0, 0, 0, 0, 0, 0, 0 };
+  for (uint16_t i = 0; i < 6000; i++) count[rh.throwDice()]++;
+
+  Serial.println("throwDice() 6000x");
+  for (int d = 1; d <= 6; d++)
+  {
+    Serial.print(d);
+    Serial.print("\t");
+    Serial.println(count[d]);
+  }
+  Serial.println("\nDone...");
+}
+
+
+// -- END OF FILE --
@@ -2,11 +2,14 @@
 //
 //    FILE: randomHelpers.h
 //  AUTHOR: Rob dot Tillaart at gmail dot com
-// VERSION: 0.2.1
+// VERSION: 0.3.0
 // PURPOSE: Arduino library with helper function for faster random bits
 //     URL: https://github.com/RobTillaart/randomHelpers
 //
 //  HISTORY:
+//  0.3.0   2021-09-22  RandomHelper class, generator state per object,
+//                      unbiased randomRange() (Lemire), fill() / randomFill(),
+//                      fix throwDice() distribution (was bit count 0..5).
 //  0.2.1   2021-01-07  Arduino-CI
 //  0.2.0   2020-07-01  rewrite.
 //  0.1.01  2015-08-18  bug fixes and further optimizations.
@@ -16,206 +19,226 @@
 
 #include "Arduino.h"
 
-#define RANDOM_HELPERS_VERSION       (F("0.2.1"))
+#define RANDOM_HELPERS_VERSION       (F("0.3.0"))
 
-// the idea is to have one buffer ( __randomBuffer) which holds 32 random bits. 
-// Every call fetches bits from that buffer and if it does not hold enough 
-// bits anymore it fills the buffer first. This way the relative expensive 
+// the idea is to have one buffer (_buffer) which holds 32 random bits.
+// Every call fetches bits from that buffer and if it does not hold enough
+// bits anymore it fills the buffer first. This way the relative expensive
 // calls to random() which produces a 32 bit number are minimized in an
 // effcient way.
 //
-// TBD: put it in a class ?
-
-uint32_t  __randomBuffer = 0;
-uint8_t   __randomIdx = 0;
+// every RandomHelper object has its own generator and buffer, so
+// different objects (e.g. tasks, ISR) do not influence each other.
+// The free functions below use one shared default object.
 
 
 ///////////////////////////////////////////////////////////////////////////
 //
-// An example of a simple pseudo-random number generator is the 
+// An example of a simple pseudo-random number generator is the
 // Multiply-with-carry method invented by George Marsaglia.
-// it has two initializers (not zero) which can be changed 
+// it has two initializers (not zero) which can be changed
 // to seed the generator.
 //
-uint32_t m_w = 1;
-uint32_t m_z = 2; 
-
-uint32_t Marsaglia()
-{
-    m_z = 36969L * (m_z & 65535L) + (m_z >> 16);
-    m_w = 18000L * (m_w & 65535L) + (m_w >> 16);
-    return (m_z << 16) + m_w;  /* 32-bit result */
-} 
-
-
-uint32_t getRandom32()
+class RandomHelper
 {
-  // return random(0xFFFFFFFF);  // use the built in
-  return Marsaglia();
-}
+public:
+  RandomHelper(uint32_t w = 1, uint32_t z = 2)
+  {
+    seed(w, z);
+  };
 
 
-bool getRandom1()
-{
-  if (__randomIdx < 1)
+  // zero is not allowed, replaced by the default.
+  void seed(uint32_t w, uint32_t z)
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  bool rv = __randomBuffer & 0x01;
-  __randomBuffer >>= 1;
-  __randomIdx--;
-  return rv;
-}
-
-// typical use 
-bool inline flipCoin()
-{ 
-  return getRandom1();
-};
+    _w = (w == 0) ? 1 : w;
+    _z = (z == 0) ? 2 : z;
+    _buffer = 0;
+    _idx = 0;
+  };
 
 
-uint8_t getRandom4()
-{
-  if (__randomIdx < 4)
+  uint32_t getRandom32()
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint8_t rv = __randomBuffer & 0x0F;
-  __randomBuffer >>= 4;
-  __randomIdx -= 4;
-  return rv;
-}
+    _z = 36969L * (_z & 65535L) + (_z >> 16);
+    _w = 18000L * (_w & 65535L) + (_w >> 16);
+    return (_z << 16) + _w;  /* 32-bit result */
+  };
+
+
+  bool     getRandom1()   { return _getBits(1); };
+  uint8_t  getRandom4()   { return _getBits(4); };
+  uint8_t  getRandom5()   { return _getBits(5); };
+  uint8_t  getRandom6()   { return _getBits(6); };
+  uint8_t  getRandom8()   { return _getBits(8); };
+  uint16_t getRandom16()  { return _getBits(16); };
+  uint32_t getRandom24()  { return getRandom32() & 0xFFFFFF; };
+  uint64_t getRandom64()
+  {
+    uint64_t rv = getRandom32();
+    rv <<= 32;
+    rv |= getRandom32();
+    return rv;
+  };
 
 
-uint8_t getRandom5()
-{
-  if (__randomIdx < 5)
+  // n = 1..32
+  // TODO: performance gain too low for n > 16
+  uint32_t getRandomBits(uint8_t n)
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint8_t rv = __randomBuffer & 0x1F;
-  __randomBuffer >>= 5;
-  __randomIdx -= 5;
-  return rv;
-}
+    uint32_t rv = 0;
 
+    // for large values of n the more straightforward approach is faster (UNO).
+    if (n > 32) n = 32;
+    if (n >= 20) return getRandom32() >> (32 - n);
 
-uint8_t getRandom6()
-{
-  if (__randomIdx < 6)
-  {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint8_t rv = __randomBuffer & 0x3F;
-  __randomBuffer >>= 6;
-  __randomIdx -= 6;
-  return rv;
-}
+    if (n >= _idx)
+    {
+      if (_idx > 0)
+      {
+        n -= _idx;
+        rv = _buffer << n;
+      }
+      _buffer = getRandom32();
+      _idx = 32;
+    }
+    if (n > 0)  // more bits needed?
+    {
+      rv |= _buffer & ((1UL << n) - 1);
+      _buffer >>= n;
+      _idx -= n;
+    }
+    return rv;
+  };
 
 
-// typical use
-uint8_t inline throwDice() 
-{
-  uint8_t rv = 0;
-  uint8_t x = getRandom5();
-  for (uint8_t i = 0; i < 6 ; i++)
+  // unbiased 0 .. n-1, n == 0 returns 0.
+  // Lemire, "Fast Random Integer Generation in an Interval", 2019
+  // the high part of random * n is the result, the rare biased low
+  // parts are rejected. The modulo is only needed in that rare case.
+  uint32_t randomRange(uint32_t n)
   {
-    if (x & 1) rv++;
-    x >>= 1;
-  }
-  return rv;
-}
+#if defined(__AVR__)
+    // 32x32 => 64 bit multiply is expensive on AVR
+    if (n <= 0xFFFF) return randomRange16(n);
+#endif
+    if (n == 0) return 0;
+    uint64_t m = (uint64_t)getRandom32() * n;
+    uint32_t low = m;
+    if (low < n)
+    {
+      uint32_t threshold = (0 - n) % n;             // 2^32 mod n
+      while (low < threshold)
+      {
+        m = (uint64_t)getRandom32() * n;
+        low = m;
+      }
+    }
+    return m >> 32;
+  };
 
 
-uint8_t getRandom8()
-{
-  if (__randomIdx < 8)
+  // idem, 16 random bits from the buffer and a 16x16 bit multiply.
+  uint16_t randomRange16(uint16_t n)
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint8_t rv = __randomBuffer & 0xFF;
-  __randomBuffer >>= 8;
-  __randomIdx -= 8;
-  return rv;
-}
+    if (n == 0) return 0;
+    uint32_t m = (uint32_t)getRandom16() * n;
+    uint16_t low = m;
+    if (low < n)
+    {
+      uint16_t threshold = (uint16_t)(0 - n) % n;   // 2^16 mod n
+      while (low < threshold)
+      {
+        m = (uint32_t)getRandom16() * n;
+        low = m;
+      }
+    }
+    return m >> 16;
+  };
 
 
-uint16_t getRandom16()
-{
-  if (__randomIdx < 16)
+  // unbiased lo .. hi inclusive
+  int32_t randomRange(int32_t lo, int32_t hi)
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint16_t rv = __randomBuffer & 0xFFFF;
-  __randomBuffer >>= 16;
-  __randomIdx -= 16;
-  return rv;
-}
+    if (hi <= lo) return lo;
+    uint32_t span = (uint32_t)hi - (uint32_t)lo;
+    if (span == 0xFFFFFFFF) return getRandom32();
+    return (int32_t)((uint32_t)lo + randomRange(span + 1));
+  };
 
 
-uint32_t getRandom24()
-{
-  return getRandom32() & 0xFFFFFF;
-}
+  // typical use
+  bool    flipCoin()   { return getRandom1(); };
+  uint8_t throwDice()  { return 1 + randomRange(6); };
 
-uint64_t getRandom64()
-{
-  uint64_t rv = getRandom32();
-  rv <<= 32;
-  rv |= getRandom32();
-  return rv;
-}
-
-/*
-// works well for 1..16; but above it is worse
-uint32_t getRandomBits(uint8_t n)
-{
-  if (__randomIdx < n)
+
+  // bulk, 4 bytes per call of the generator, does not use the bit buffer.
+  void fill(uint8_t * buf, uint16_t n)
   {
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  uint32_t rv = __randomBuffer & ((1UL << n) - 1);
-  __randomBuffer >>= n;
-  __randomIdx -= n;
-  return rv;
-}
-*/
-
-
-// n = 1..31
-// TODO: performance gain too low for n > 16
-uint32_t getRandomBits(uint8_t n) 
-{
-  uint32_t rv = 0;
+    while (n >= 4)
+    {
+      uint32_t r = getRandom32();
+      memcpy(buf, &r, 4);
+      buf += 4;
+      n -= 4;
+    }
+    if (n > 0)
+    {
+      uint32_t r = getRandom32();
+      memcpy(buf, &r, n);
+    }
+  };
 
-  // for large values of n the more straightforward approach is faster (UNO).
-  if (n > 32) n = 32;
-  if (n >= 20) return getRandom32() >> (32 - n);
 
-  if (n >= __randomIdx)
+private:
+  // n = 1..16
+  uint16_t _getBits(uint8_t n)
   {
-    if (__randomIdx > 0)
+    if (_idx < n)
     {
-      n -= __randomIdx;
-      rv = __randomBuffer << n;
+      _buffer = getRandom32();
+      _idx = 32;
     }
-    __randomBuffer = getRandom32();
-    __randomIdx = 32;
-  }
-  if (n > 0)  // more bits needed?
-  {
-    rv |= __randomBuffer & ((1UL << n) - 1);
-    __randomBuffer >>= n;
-    __randomIdx -= n;
-  }
-  return rv;
-}
+    uint16_t rv = _buffer & ((1UL << n) - 1);
+    _buffer >>= n;
+    _idx -= n;
+    return rv;
+  };
+
+  uint32_t _w;
+  uint32_t _z;
+  uint32_t _buffer;
+  uint8_t  _idx;
+};
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// FREE FUNCTIONS - shared default generator, not reentrant.
+//
+RandomHelper __randomHelper;
+
+// replaces setting the globals m_w and m_z (before 0.3.0)
+void     randomHelperSeed(uint32_t w, uint32_t z)  { __randomHelper.seed(w, z); };
+
+uint32_t Marsaglia()                      { return __randomHelper.getRandom32(); };
+uint32_t getRandom32()                    { return __randomHelper.getRandom32(); };
+bool     getRandom1()                     { return __randomHelper.getRandom1(); };
+uint8_t  getRandom4()                     { return __randomHelper.getRandom4(); };
+uint8_t  getRandom5()                     { return __randomHelper.getRandom5(); };
+uint8_t  getRandom6()                     { return __randomHelper.getRandom6(); };
+uint8_t  getRandom8()                     { return __randomHelper.getRandom8(); };
+uint16_t getRandom16()                    { return __randomHelper.getRandom16(); };
+uint32_t getRandom24()                    { return __randomHelper.getRandom24(); };
+uint64_t getRandom64()                    { return __randomHelper.getRandom64(); };
+uint32_t getRandomBits(uint8_t n)         { return __randomHelper.getRandomBits(n); };
+uint32_t randomRange(uint32_t n)          { return __randomHelper.randomRange(n); };
+uint16_t randomRange16(uint16_t n)        { return __randomHelper.randomRange16(n); };
+void     randomFill(uint8_t * buf, uint16_t n)  { __randomHelper.fill(buf, n); };
+
+// typical use
+bool    inline flipCoin()                 { return __randomHelper.getRandom1(); };
+uint8_t inline throwDice()                { return __randomHelper.throwDice(); };
+
 
 // -- END OF FILE --
@@ -77,6 +77,158 @@ unittest(test_all)
   
 }
 
+// chi square of count[] against a uniform expectation.
+float chiSquare(const uint32_t * count, uint16_t bins, uint32_t total)
+{
+  float expected = (float)total / bins;
+  float chi2 = 0;
+  for (uint16_t i = 0; i < bins; i++)
+  {
+    float d = count[i] - expected;
+    chi2 += d * d / expected;
+  }
+  return chi2;
+}
+
+
+unittest(test_randomRange_bounds)
+{
+  RandomHelper rh;
+  uint32_t range[10] = { 1, 2, 3, 6, 7, 1000, 65535, 65536, 100000, 3000000000UL };
+  for (int r = 0; r < 10; r++)
+  {
+    for (int i = 0; i < 1000; i++)
+    {
+      assertMore(range[r], rh.randomRange(range[r]));
+    }
+  }
+  for (int r = 0; r < 7; r++)
+  {
+    for (int i = 0; i < 1000; i++)
+    {
+      assertMore(range[r], rh.randomRange16(range[r]));
+    }
+  }
+  assertEqual(0, rh.randomRange(0));
+  assertEqual(0, rh.randomRange16(0));
+  for (int i = 0; i < 1000; i++)
+  {
+    int32_t x = rh.randomRange(-5, 5);
+    assertMoreOrEqual(x, -5);
+    assertMoreOrEqual(5, x);
+  }
+  assertEqual(42, rh.randomRange(42, 42));
+  // wide ranges, lo + offset must not overflow
+  for (int i = 0; i < 1000; i++)
+  {
+    int32_t x = rh.randomRange(-2147483647L - 1, 2147483646L);
+    assertMoreOrEqual(2147483646L, x);
+    x = rh.randomRange(-2000000000L, 2000000000L);
+    assertMoreOrEqual(x, -2000000000L);
+    assertMoreOrEqual(2000000000L, x);
+  }
+}
+
+
+// critical chi square values for p = 0.001
+unittest(test_randomRange_uniform)
+{
+  RandomHelper rh(12345, 67890);
+  uint32_t count[256];
+
+  // df = 5 => 20.52
+  memset(count, 0, sizeof(count));
+  for (uint32_t i = 0; i < 60000; i++) count[rh.randomRange(6)]++;
+  float chi2 = chiSquare(count, 6, 60000);
+  fprintf(stderr, "randomRange(6)\t%f\n", chi2);
+  assertMore(20.52, chi2);
+
+  memset(count, 0, sizeof(count));
+  for (uint32_t i = 0; i < 60000; i++) count[rh.randomRange16(6)]++;
+  chi2 = chiSquare(count, 6, 60000);
+  fprintf(stderr, "randomRange16(6)\t%f\n", chi2);
+  assertMore(20.52, chi2);
+
+  // df = 99 => 148.2
+  memset(count, 0, sizeof(count));
+  for (uint32_t i = 0; i < 100000; i++) count[rh.randomRange(100)]++;
+  chi2 = chiSquare(count, 100, 100000);
+  fprintf(stderr, "randomRange(100)\t%f\n", chi2);
+  assertMore(148.2, chi2);
+
+  // 32 bit path, 3 buckets of 2^30 => df = 2 => 13.82
+  // with modulo the lowest bucket would get 50% of the values.
+  memset(count, 0, sizeof(count));
+  for (uint32_t i = 0; i < 30000; i++) count[rh.randomRange(3221225472UL) >> 30]++;
+  chi2 = chiSquare(count, 3, 30000);
+  fprintf(stderr, "randomRange(3 x 2^30)\t%f\n", chi2);
+  assertMore(13.82, chi2);
+}
+
+
+unittest(test_throwDice)
+{
+  uint32_t count[7] = { 0, 0, 0, 0, 0, 0, 0 };
+  for (uint32_t i = 0; i < 60000; i++)
+  {
+    uint8_t d = throwDice();
+    assertMore(7, d);
+    count[d]++;
+  }
+  assertEqual(0, count[0]);
+  float chi2 = chiSquare(count + 1, 6, 60000);
+  fprintf(stderr, "throwDice()\t%f\n", chi2);
+  assertMore(20.52, chi2);
+}
+
+
+unittest(test_fill)
+{
+  RandomHelper rh;
+  uint8_t buf[1003];
+  uint32_t count[256];
+  memset(count, 0, sizeof(count));
+  for (int r = 0; r < 50; r++)
+  {
+    buf[1002] = 0xAA;
+    rh.fill(buf, 1002);
+    assertEqual(0xAA, buf[1002]);   // no overrun
+    for (int i = 0; i < 1002; i++) count[buf[i]]++;
+  }
+  // df = 255 => 330.5
+  float chi2 = chiSquare(count, 256, 50 * 1002UL);
+  fprintf(stderr, "fill()\t%f\n", chi2);
+  assertMore(330.5, chi2);
+}
+
+
+unittest(test_instances)
+{
+  RandomHelper a(7, 8);
+  RandomHelper b(7, 8);
+  RandomHelper c(1, 1);
+
+  // same seed => same sequence, independent of other generators.
+  for (int i = 0; i < 100; i++)
+  {
+    uint32_t x = a.randomRange(1000);
+    c.getRandom32();
+    getRandom8();
+    c.getRandom5();
+    assertEqual(x, b.randomRange(1000));
+    assertEqual(a.getRandom5(), b.getRandom5());
+  }
+  a.seed(3, 4);
+  b.seed(3, 4);
+  assertEqual(a.getRandom32(), b.getRandom32());
+
+  // shared default object
+  randomHelperSeed(3, 4);
+  a.seed(3, 4);
+  assertEqual(a.getRandom32(), getRandom32());
+}
+
+
 unittest_main()
 
 // --------